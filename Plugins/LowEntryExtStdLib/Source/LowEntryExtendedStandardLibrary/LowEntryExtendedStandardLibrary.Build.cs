@@ -19,7 +19,11 @@ public class LowEntryExtendedStandardLibrary : ModuleRules
 				Path.Combine(ModuleDirectory, "Public/FClassesLatentAction"),
 				Path.Combine(ModuleDirectory, "Public/FClassesTick"),
 				Path.Combine(ModuleDirectory, "Public/FClassesDelay"),
-				Path.Combine(ModuleDirectory, "Public/FClassesExecutionQueue")
+				Path.Combine(ModuleDirectory, "Public/FClassesExecutionQueue"),
+				Path.Combine(ModuleDirectory, "Public/FClassesByteData"),
+				Path.Combine(ModuleDirectory, "Public/FClassesHashcash"),
+				Path.Combine(ModuleDirectory, "Public/FClassesBCrypt"),
+				Path.Combine(ModuleDirectory, "Public/FClassesImage")
 			}
 		);
 
@@ -53,6 +57,8 @@ public class LowEntryExtendedStandardLibrary : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"RHI",
+				"RenderCore"
 			}
 		);
 
@@ -61,5 +67,10 @@ public class LowEntryExtendedStandardLibrary : ModuleRules
 			{
 			}
 		);
+
+		if (Target.Platform == UnrealTargetPlatform.Win64)
+		{
+			PublicSystemLibraries.Add("bcrypt.lib");
+		}
 	}
 }
\ No newline at end of file
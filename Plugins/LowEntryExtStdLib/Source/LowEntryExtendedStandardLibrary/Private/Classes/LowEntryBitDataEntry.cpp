@@ -3,14 +3,24 @@
 #include "LowEntryBitDataEntry.h"
 
 
+namespace LowEntryBitDataEntry
+{
+	template<typename T>
+	TArray<T*> CastObjects(const TArray<UObject*>& Objects)
+	{
+		TArray<T*> Result;
+		Result.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			Result.Add(Cast<T>(Object));
+		}
+		return Result;
+	}
+}
+
+
 ULowEntryBitDataEntry::ULowEntryBitDataEntry(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
-	, ByteValue(0)
-	, IntegerValue(0)
-	, LongValue(0)
-	, FloatValue(0)
-	, DoubleValue(0)
-	, BooleanValue(false) {}
+	: Super(ObjectInitializer) {}
 
 ULowEntryBitDataEntry* ULowEntryBitDataEntry::CreateFromBit(const bool Value)
 {
@@ -228,7 +238,7 @@ ULowEntryBitDataEntry* ULowEntryBitDataEntry::CreateFromStringUtf8Array(const TA
 
 int32 ULowEntryBitDataEntry::GetBitCount()
 {
-	return IntegerValue;
+	return BitCountValue;
 }
 
 
@@ -239,11 +249,12 @@ bool ULowEntryBitDataEntry::IsBit()
 void ULowEntryBitDataEntry::SetBit(const bool Value)
 {
 	Type = 11;
-	BooleanValue = Value;
+	ObjectValues.Empty();
+	Storage.SetBoolean(Value);
 }
 bool ULowEntryBitDataEntry::GetBit()
 {
-	return BooleanValue;
+	return Storage.GetBoolean();
 }
 
 bool ULowEntryBitDataEntry::IsByteLeastSignificantBits()
@@ -253,12 +264,13 @@ bool ULowEntryBitDataEntry::IsByteLeastSignificantBits()
 void ULowEntryBitDataEntry::SetByteLeastSignificantBits(const uint8 Value, const int32 BitCount)
 {
 	Type = 12;
-	ByteValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetByte(Value);
+	BitCountValue = BitCount;
 }
 uint8 ULowEntryBitDataEntry::GetByteLeastSignificantBits()
 {
-	return ByteValue;
+	return Storage.GetByte();
 }
 
 bool ULowEntryBitDataEntry::IsByteMostSignificantBits()
@@ -268,12 +280,13 @@ bool ULowEntryBitDataEntry::IsByteMostSignificantBits()
 void ULowEntryBitDataEntry::SetByteMostSignificantBits(const uint8 Value, const int32 BitCount)
 {
 	Type = 13;
-	ByteValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetByte(Value);
+	BitCountValue = BitCount;
 }
 uint8 ULowEntryBitDataEntry::GetByteMostSignificantBits()
 {
-	return ByteValue;
+	return Storage.GetByte();
 }
 
 bool ULowEntryBitDataEntry::IsIntegerLeastSignificantBits()
@@ -283,12 +296,13 @@ bool ULowEntryBitDataEntry::IsIntegerLeastSignificantBits()
 void ULowEntryBitDataEntry::SetIntegerLeastSignificantBits(const int32 Value, const int32 BitCount)
 {
 	Type = 14;
-	IntegerValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
+	BitCountValue = BitCount;
 }
 int32 ULowEntryBitDataEntry::GetIntegerLeastSignificantBits()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryBitDataEntry::IsIntegerMostSignificantBits()
@@ -298,12 +312,13 @@ bool ULowEntryBitDataEntry::IsIntegerMostSignificantBits()
 void ULowEntryBitDataEntry::SetIntegerMostSignificantBits(const int32 Value, const int32 BitCount)
 {
 	Type = 15;
-	IntegerValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
+	BitCountValue = BitCount;
 }
 int32 ULowEntryBitDataEntry::GetIntegerMostSignificantBits()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 
@@ -314,11 +329,12 @@ bool ULowEntryBitDataEntry::IsByte()
 void ULowEntryBitDataEntry::SetByte(const uint8 Value)
 {
 	Type = 1;
-	ByteValue = Value;
+	ObjectValues.Empty();
+	Storage.SetByte(Value);
 }
 uint8 ULowEntryBitDataEntry::GetByte()
 {
-	return ByteValue;
+	return Storage.GetByte();
 }
 
 bool ULowEntryBitDataEntry::IsInteger()
@@ -328,11 +344,12 @@ bool ULowEntryBitDataEntry::IsInteger()
 void ULowEntryBitDataEntry::SetInteger(const int32 Value)
 {
 	Type = 2;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryBitDataEntry::GetInteger()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger1()
@@ -342,11 +359,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger1()
 void ULowEntryBitDataEntry::SetPositiveInteger1(const int32 Value)
 {
 	Type = 8;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryBitDataEntry::GetPositiveInteger1()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger2()
@@ -356,11 +374,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger2()
 void ULowEntryBitDataEntry::SetPositiveInteger2(const int32 Value)
 {
 	Type = 9;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryBitDataEntry::GetPositiveInteger2()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger3()
@@ -370,11 +389,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger3()
 void ULowEntryBitDataEntry::SetPositiveInteger3(const int32 Value)
 {
 	Type = 10;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryBitDataEntry::GetPositiveInteger3()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryBitDataEntry::IsLong()
@@ -384,11 +404,12 @@ bool ULowEntryBitDataEntry::IsLong()
 void ULowEntryBitDataEntry::SetLong(const int64 Value)
 {
 	Type = 11;
-	LongValue = Value;
+	ObjectValues.Empty();
+	Storage.SetLong(Value);
 }
 int64 ULowEntryBitDataEntry::GetLong()
 {
-	return LongValue;
+	return Storage.GetLong();
 }
 
 bool ULowEntryBitDataEntry::IsLongBytes()
@@ -398,11 +419,13 @@ bool ULowEntryBitDataEntry::IsLongBytes()
 void ULowEntryBitDataEntry::SetLongBytes(ULowEntryLong* Value)
 {
 	Type = 3;
-	LongBytesValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(1);
+	ObjectValues.Add(Value);
 }
 ULowEntryLong* ULowEntryBitDataEntry::GetLongBytes()
 {
-	return LongBytesValue;
+	return ((ObjectValues.Num() > 0) ? Cast<ULowEntryLong>(ObjectValues[0]) : nullptr);
 }
 
 
@@ -413,11 +436,12 @@ bool ULowEntryBitDataEntry::IsFloat()
 void ULowEntryBitDataEntry::SetFloat(const float Value)
 {
 	Type = 4;
-	FloatValue = Value;
+	ObjectValues.Empty();
+	Storage.SetFloat(Value);
 }
 float ULowEntryBitDataEntry::GetFloat()
 {
-	return FloatValue;
+	return Storage.GetFloat();
 }
 
 bool ULowEntryBitDataEntry::IsDouble()
@@ -427,11 +451,12 @@ bool ULowEntryBitDataEntry::IsDouble()
 void ULowEntryBitDataEntry::SetDouble(const double Value)
 {
 	Type = 16;
-	DoubleValue = Value;
+	ObjectValues.Empty();
+	Storage.SetDouble(Value);
 }
 double ULowEntryBitDataEntry::GetDouble()
 {
-	return DoubleValue;
+	return Storage.GetDouble();
 }
 
 bool ULowEntryBitDataEntry::IsDoubleBytes()
@@ -441,11 +466,13 @@ bool ULowEntryBitDataEntry::IsDoubleBytes()
 void ULowEntryBitDataEntry::SetDoubleBytes(ULowEntryDouble* Value)
 {
 	Type = 5;
-	DoubleBytesValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(1);
+	ObjectValues.Add(Value);
 }
 ULowEntryDouble* ULowEntryBitDataEntry::GetDoubleBytes()
 {
-	return DoubleBytesValue;
+	return ((ObjectValues.Num() > 0) ? Cast<ULowEntryDouble>(ObjectValues[0]) : nullptr);
 }
 
 
@@ -456,11 +483,12 @@ bool ULowEntryBitDataEntry::IsBoolean()
 void ULowEntryBitDataEntry::SetBoolean(const bool Value)
 {
 	Type = 6;
-	BooleanValue = Value;
+	ObjectValues.Empty();
+	Storage.SetBoolean(Value);
 }
 bool ULowEntryBitDataEntry::GetBoolean()
 {
-	return BooleanValue;
+	return Storage.GetBoolean();
 }
 
 bool ULowEntryBitDataEntry::IsStringUtf8()
@@ -470,11 +498,12 @@ bool ULowEntryBitDataEntry::IsStringUtf8()
 void ULowEntryBitDataEntry::SetStringUtf8(const FString& Value)
 {
 	Type = 7;
-	StringUtf8Value = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-FString ULowEntryBitDataEntry::GetStringUtf8()
+const FString& ULowEntryBitDataEntry::GetStringUtf8()
 {
-	return StringUtf8Value;
+	return Storage.GetPayload<FString>();
 }
 
 
@@ -485,11 +514,12 @@ bool ULowEntryBitDataEntry::IsBitArray()
 void ULowEntryBitDataEntry::SetBitArray(const TArray<bool>& Value)
 {
 	Type = 111;
-	BooleanArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<bool> ULowEntryBitDataEntry::GetBitArray()
+const TArray<bool>& ULowEntryBitDataEntry::GetBitArray()
 {
-	return BooleanArrayValue;
+	return Storage.GetPayload<TArray<bool>>();
 }
 
 bool ULowEntryBitDataEntry::IsByteArrayLeastSignificantBits()
@@ -499,12 +529,13 @@ bool ULowEntryBitDataEntry::IsByteArrayLeastSignificantBits()
 void ULowEntryBitDataEntry::SetByteArrayLeastSignificantBits(const TArray<uint8>& Value, const int32 BitCount)
 {
 	Type = 112;
-	ByteArrayValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+	BitCountValue = BitCount;
 }
-TArray<uint8> ULowEntryBitDataEntry::GetByteArrayLeastSignificantBits()
+const TArray<uint8>& ULowEntryBitDataEntry::GetByteArrayLeastSignificantBits()
 {
-	return ByteArrayValue;
+	return Storage.GetPayload<TArray<uint8>>();
 }
 
 bool ULowEntryBitDataEntry::IsByteArrayMostSignificantBits()
@@ -514,12 +545,13 @@ bool ULowEntryBitDataEntry::IsByteArrayMostSignificantBits()
 void ULowEntryBitDataEntry::SetByteArrayMostSignificantBits(const TArray<uint8>& Value, const int32 BitCount)
 {
 	Type = 113;
-	ByteArrayValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+	BitCountValue = BitCount;
 }
-TArray<uint8> ULowEntryBitDataEntry::GetByteArrayMostSignificantBits()
+const TArray<uint8>& ULowEntryBitDataEntry::GetByteArrayMostSignificantBits()
 {
-	return ByteArrayValue;
+	return Storage.GetPayload<TArray<uint8>>();
 }
 
 bool ULowEntryBitDataEntry::IsIntegerArrayLeastSignificantBits()
@@ -529,12 +561,13 @@ bool ULowEntryBitDataEntry::IsIntegerArrayLeastSignificantBits()
 void ULowEntryBitDataEntry::SetIntegerArrayLeastSignificantBits(const TArray<int32>& Value, const int32 BitCount)
 {
 	Type = 114;
-	IntegerArrayValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+	BitCountValue = BitCount;
 }
-TArray<int32> ULowEntryBitDataEntry::GetIntegerArrayLeastSignificantBits()
+const TArray<int32>& ULowEntryBitDataEntry::GetIntegerArrayLeastSignificantBits()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryBitDataEntry::IsIntegerArrayMostSignificantBits()
@@ -544,12 +577,13 @@ bool ULowEntryBitDataEntry::IsIntegerArrayMostSignificantBits()
 void ULowEntryBitDataEntry::SetIntegerArrayMostSignificantBits(const TArray<int32>& Value, const int32 BitCount)
 {
 	Type = 115;
-	IntegerArrayValue = Value;
-	IntegerValue = BitCount;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+	BitCountValue = BitCount;
 }
-TArray<int32> ULowEntryBitDataEntry::GetIntegerArrayMostSignificantBits()
+const TArray<int32>& ULowEntryBitDataEntry::GetIntegerArrayMostSignificantBits()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 
@@ -560,11 +594,12 @@ bool ULowEntryBitDataEntry::IsByteArray()
 void ULowEntryBitDataEntry::SetByteArray(const TArray<uint8>& Value)
 {
 	Type = 101;
-	ByteArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<uint8> ULowEntryBitDataEntry::GetByteArray()
+const TArray<uint8>& ULowEntryBitDataEntry::GetByteArray()
 {
-	return ByteArrayValue;
+	return Storage.GetPayload<TArray<uint8>>();
 }
 
 bool ULowEntryBitDataEntry::IsIntegerArray()
@@ -574,11 +609,12 @@ bool ULowEntryBitDataEntry::IsIntegerArray()
 void ULowEntryBitDataEntry::SetIntegerArray(const TArray<int32>& Value)
 {
 	Type = 102;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryBitDataEntry::GetIntegerArray()
+const TArray<int32>& ULowEntryBitDataEntry::GetIntegerArray()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger1Array()
@@ -588,11 +624,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger1Array()
 void ULowEntryBitDataEntry::SetPositiveInteger1Array(const TArray<int32>& Value)
 {
 	Type = 108;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryBitDataEntry::GetPositiveInteger1Array()
+const TArray<int32>& ULowEntryBitDataEntry::GetPositiveInteger1Array()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger2Array()
@@ -602,11 +639,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger2Array()
 void ULowEntryBitDataEntry::SetPositiveInteger2Array(const TArray<int32>& Value)
 {
 	Type = 109;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryBitDataEntry::GetPositiveInteger2Array()
+const TArray<int32>& ULowEntryBitDataEntry::GetPositiveInteger2Array()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryBitDataEntry::IsPositiveInteger3Array()
@@ -616,11 +654,12 @@ bool ULowEntryBitDataEntry::IsPositiveInteger3Array()
 void ULowEntryBitDataEntry::SetPositiveInteger3Array(const TArray<int32>& Value)
 {
 	Type = 110;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryBitDataEntry::GetPositiveInteger3Array()
+const TArray<int32>& ULowEntryBitDataEntry::GetPositiveInteger3Array()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryBitDataEntry::IsLongArray()
@@ -630,11 +669,12 @@ bool ULowEntryBitDataEntry::IsLongArray()
 void ULowEntryBitDataEntry::SetLongArray(const TArray<int64>& Value)
 {
 	Type = 111;
-	LongArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int64> ULowEntryBitDataEntry::GetLongArray()
+const TArray<int64>& ULowEntryBitDataEntry::GetLongArray()
 {
-	return LongArrayValue;
+	return Storage.GetPayload<TArray<int64>>();
 }
 
 bool ULowEntryBitDataEntry::IsLongBytesArray()
@@ -644,11 +684,13 @@ bool ULowEntryBitDataEntry::IsLongBytesArray()
 void ULowEntryBitDataEntry::SetLongBytesArray(const TArray<ULowEntryLong*>& Value)
 {
 	Type = 103;
-	LongBytesArrayValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
 }
 TArray<ULowEntryLong*> ULowEntryBitDataEntry::GetLongBytesArray()
 {
-	return LongBytesArrayValue;
+	return LowEntryBitDataEntry::CastObjects<ULowEntryLong>(ObjectValues);
 }
 
 
@@ -659,11 +701,12 @@ bool ULowEntryBitDataEntry::IsFloatArray()
 void ULowEntryBitDataEntry::SetFloatArray(const TArray<float>& Value)
 {
 	Type = 104;
-	FloatArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<float> ULowEntryBitDataEntry::GetFloatArray()
+const TArray<float>& ULowEntryBitDataEntry::GetFloatArray()
 {
-	return FloatArrayValue;
+	return Storage.GetPayload<TArray<float>>();
 }
 
 bool ULowEntryBitDataEntry::IsDoubleArray()
@@ -673,11 +716,12 @@ bool ULowEntryBitDataEntry::IsDoubleArray()
 void ULowEntryBitDataEntry::SetDoubleArray(const TArray<double>& Value)
 {
 	Type = 116;
-	DoubleArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<double> ULowEntryBitDataEntry::GetDoubleArray()
+const TArray<double>& ULowEntryBitDataEntry::GetDoubleArray()
 {
-	return DoubleArrayValue;
+	return Storage.GetPayload<TArray<double>>();
 }
 
 bool ULowEntryBitDataEntry::IsDoubleBytesArray()
@@ -687,11 +731,13 @@ bool ULowEntryBitDataEntry::IsDoubleBytesArray()
 void ULowEntryBitDataEntry::SetDoubleBytesArray(const TArray<ULowEntryDouble*>& Value)
 {
 	Type = 105;
-	DoubleBytesArrayValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
 }
 TArray<ULowEntryDouble*> ULowEntryBitDataEntry::GetDoubleBytesArray()
 {
-	return DoubleBytesArrayValue;
+	return LowEntryBitDataEntry::CastObjects<ULowEntryDouble>(ObjectValues);
 }
 
 
@@ -702,11 +748,12 @@ bool ULowEntryBitDataEntry::IsBooleanArray()
 void ULowEntryBitDataEntry::SetBooleanArray(const TArray<bool>& Value)
 {
 	Type = 106;
-	BooleanArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<bool> ULowEntryBitDataEntry::GetBooleanArray()
+const TArray<bool>& ULowEntryBitDataEntry::GetBooleanArray()
 {
-	return BooleanArrayValue;
+	return Storage.GetPayload<TArray<bool>>();
 }
 
 bool ULowEntryBitDataEntry::IsStringUtf8Array()
@@ -716,9 +763,10 @@ bool ULowEntryBitDataEntry::IsStringUtf8Array()
 void ULowEntryBitDataEntry::SetStringUtf8Array(const TArray<FString>& Value)
 {
 	Type = 107;
-	StringUtf8ArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<FString> ULowEntryBitDataEntry::GetStringUtf8Array()
+const TArray<FString>& ULowEntryBitDataEntry::GetStringUtf8Array()
 {
-	return StringUtf8ArrayValue;
+	return Storage.GetPayload<TArray<FString>>();
 }
@@ -5,9 +5,6 @@
 #include "LowEntryExtendedStandardLibrary.h"
 
 
-constexpr uint8 ULowEntryBitDataWriter::mask[9] = {static_cast<uint8>(0x00), static_cast<uint8>(0x01), static_cast<uint8>(0x03), static_cast<uint8>(0x07), static_cast<uint8>(0x0F), static_cast<uint8>(0x1F), static_cast<uint8>(0x3F), static_cast<uint8>(0x7F), static_cast<uint8>(0xFF)};
-
-
 ULowEntryBitDataWriter::ULowEntryBitDataWriter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
 
 ULowEntryBitDataWriter* ULowEntryBitDataWriter::Create()
@@ -167,492 +164,188 @@ ULowEntryBitDataWriter* ULowEntryBitDataWriter::CreateFromEntryArray(const TArra
 
 void ULowEntryBitDataWriter::AddRawBit(const bool Value)
 {
-	if (Value)
-	{
-		CurrentByte |= (1 << CurrentBytePosition);
-	}
-
-	if (CurrentBytePosition == 7)
-	{
-		Bytes.Add(CurrentByte);
-		CurrentByte = 0;
-		CurrentBytePosition = 0;
-	}
-	else
-	{
-		CurrentBytePosition++;
-	}
+	Writer.AddRawBit(Value);
 }
 
 void ULowEntryBitDataWriter::AddRawByte(const uint8 Value)
 {
-	if (CurrentBytePosition == 0)
-	{
-		Bytes.Add(Value);
-	}
-	else
-	{
-		CurrentByte |= (Value << CurrentBytePosition);
-		Bytes.Add(CurrentByte);
-		CurrentByte = static_cast<uint8>((Value >> (8 - CurrentBytePosition)) & mask[CurrentBytePosition]);
-	}
+	Writer.AddRawByte(Value);
 }
 
 void ULowEntryBitDataWriter::AddPartialRawByte(uint8 Value, int32 Bits)
 {
-	if (Bits == 0)
-	{
-		return;
-	}
-	if ((Bits >= 8) || (Bits <= -8))
-	{
-		AddRawByte(Value);
-		return;
-	}
-
-	if (Bits < 0)
-	{
-		Bits = -Bits;
-		Value >>= (8 - Bits);
-	}
-
-	Value &= mask[Bits];
-
-	CurrentByte |= (Value << CurrentBytePosition);
-	CurrentBytePosition += Bits;
-
-	if (CurrentBytePosition >= 8)
-	{
-		Bytes.Add(CurrentByte);
-		CurrentBytePosition -= 8;
-		if (CurrentBytePosition == 0)
-		{
-			CurrentByte = 0;
-		}
-		else
-		{
-			CurrentByte = static_cast<uint8>(Value >> (Bits - CurrentBytePosition)); // b is already masked
-		}
-	}
+	Writer.AddPartialRawByte(Value, Bits);
 }
 
 void ULowEntryBitDataWriter::AddRawBytes(const TArray<uint8>& Value)
 {
-	if (CurrentBytePosition == 0)
-	{
-		Bytes.Append(Value);
-	}
-	else
-	{
-		for (uint8 V : Value)
-		{
-			AddRawByte(V);
-		}
-	}
+	Writer.AddRawBytes(Value);
 }
 
 
 TArray<uint8> ULowEntryBitDataWriter::GetBytes()
 {
-	if (CurrentBytePosition == 0)
-	{
-		return Bytes;
-	}
-	TArray<uint8> Data = Bytes;
-	Data.Add(CurrentByte);
-	return Data;
+	return Writer.GetBytes();
 }
 
 
 void ULowEntryBitDataWriter::AddBit(const bool Value)
 {
-	AddRawBit(Value);
+	Writer.AddBit(Value);
 }
 void ULowEntryBitDataWriter::AddByteLeastSignificantBits(const uint8 Value, const int32 BitCount)
 {
-	if (BitCount > 0)
-	{
-		AddPartialRawByte(Value, BitCount);
-	}
+	Writer.AddByteLeastSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddByteMostSignificantBits(const uint8 Value, const int32 BitCount)
 {
-	if (BitCount > 0)
-	{
-		AddPartialRawByte(Value, -BitCount);
-	}
+	Writer.AddByteMostSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddIntegerLeastSignificantBits(const int32 Value, const int32 BitCount)
 {
-	if (BitCount > 0)
-	{
-		if (BitCount >= 32)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount > 24)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddPartialRawByte((Value >> 24), (BitCount - 24));
-		}
-		else if (BitCount > 16)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddPartialRawByte((Value >> 16), (BitCount - 16));
-		}
-		else if (BitCount > 8)
-		{
-			AddRawByte(Value);
-			AddPartialRawByte((Value >> 8), (BitCount - 8));
-		}
-		else
-		{
-			AddPartialRawByte(Value, BitCount);
-		}
-	}
+	Writer.AddIntegerLeastSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddIntegerMostSignificantBits(const int32 Value, int32 BitCount)
 {
-	if (BitCount > 0)
-	{
-		BitCount = -BitCount;
-		if (BitCount <= -32)
-		{
-			AddRawByte(Value);
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -24)
-		{
-			AddPartialRawByte((Value), (BitCount + 24));
-			AddRawByte(Value >> 8);
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -16)
-		{
-			AddPartialRawByte((Value >> 8), (BitCount + 16));
-			AddRawByte(Value >> 16);
-			AddRawByte(Value >> 24);
-		}
-		else if (BitCount < -8)
-		{
-			AddPartialRawByte((Value >> 16), (BitCount + 8));
-			AddRawByte(Value >> 24);
-		}
-		else
-		{
-			AddPartialRawByte((Value >> 24), BitCount);
-		}
-	}
+	Writer.AddIntegerMostSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddByte(const uint8 Value)
 {
-	AddRawByte(Value);
+	Writer.AddByte(Value);
 }
 void ULowEntryBitDataWriter::AddInteger(const int32 Value)
 {
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.AddInteger(Value);
 }
 void ULowEntryBitDataWriter::AddUinteger(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddUinteger(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger1(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger1(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger2(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 32768)
-	{
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger2(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger3(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 8388608)
-	{
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger3(Value);
 }
 void ULowEntryBitDataWriter::AddLong(const int64 Value)
 {
-	AddRawByte(Value >> 56);
-	AddRawByte(Value >> 48);
-	AddRawByte(Value >> 40);
-	AddRawByte(Value >> 32);
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.AddLong(Value);
 }
 void ULowEntryBitDataWriter::AddLongBytes(ULowEntryLong* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.AddRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryLong::GetDefaultBytes());
+		Writer.AddRawBytes(ULowEntryLong::GetDefaultBytes());
 	}
 }
 void ULowEntryBitDataWriter::AddFloat(const float Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::FloatToBytes(Value));
+	Writer.AddFloat(Value);
 }
 void ULowEntryBitDataWriter::AddDouble(const double Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::DoubleToBytes(Value));
+	Writer.AddDouble(Value);
 }
 void ULowEntryBitDataWriter::AddDoubleBytes(ULowEntryDouble* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.AddRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryDouble::GetDefaultBytes());
+		Writer.AddRawBytes(ULowEntryDouble::GetDefaultBytes());
 	}
 }
 void ULowEntryBitDataWriter::AddBoolean(const bool Value)
 {
-	AddRawBit(Value);
+	Writer.AddBoolean(Value);
 }
 void ULowEntryBitDataWriter::AddStringUtf8(const FString& Value)
 {
-	AddByteArray(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Value));
+	Writer.AddStringUtf8(Value);
+}
+void ULowEntryBitDataWriter::AddVarInteger(const int32 Value)
+{
+	Writer.AddVarInteger(Value);
+}
+void ULowEntryBitDataWriter::AddVarLong(const int64 Value)
+{
+	Writer.AddVarLong(Value);
+}
+void ULowEntryBitDataWriter::AddZigZagInteger(const int32 Value)
+{
+	Writer.AddZigZagInteger(Value);
+}
+void ULowEntryBitDataWriter::AddZigZagLong(const int64 Value)
+{
+	Writer.AddZigZagLong(Value);
 }
 
 
 void ULowEntryBitDataWriter::AddBitArray(const TArray<bool>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (bool V : Value)
-	{
-		AddBit(V);
-	}
+	Writer.AddBitArray(Value);
 }
 void ULowEntryBitDataWriter::AddByteArrayLeastSignificantBits(const TArray<uint8>& Value, const int32 BitCount)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (uint8 V : Value)
-	{
-		AddByteLeastSignificantBits(V, BitCount);
-	}
+	Writer.AddByteArrayLeastSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddByteArrayMostSignificantBits(const TArray<uint8>& Value, const int32 BitCount)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (uint8 V : Value)
-	{
-		AddByteMostSignificantBits(V, BitCount);
-	}
+	Writer.AddByteArrayMostSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddIntegerArrayLeastSignificantBits(const TArray<int32>& Value, const int32 BitCount)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddIntegerLeastSignificantBits(V, BitCount);
-	}
+	Writer.AddIntegerArrayLeastSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddIntegerArrayMostSignificantBits(const TArray<int32>& Value, const int32 BitCount)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddIntegerMostSignificantBits(V, BitCount);
-	}
+	Writer.AddIntegerArrayMostSignificantBits(Value, BitCount);
 }
 void ULowEntryBitDataWriter::AddByteArray(const TArray<uint8>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	AddRawBytes(Value);
+	Writer.AddByteArray(Value);
 }
 void ULowEntryBitDataWriter::AddIntegerArray(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddInteger(V);
-	}
+	Writer.AddIntegerArray(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger1Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger1(V);
-	}
+	Writer.AddPositiveInteger1Array(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger2Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger2(V);
-	}
+	Writer.AddPositiveInteger2Array(Value);
 }
 void ULowEntryBitDataWriter::AddPositiveInteger3Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger3(V);
-	}
+	Writer.AddPositiveInteger3Array(Value);
 }
 void ULowEntryBitDataWriter::AddLongArray(const TArray<int64>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int64 V : Value)
-	{
-		AddLong(V);
-	}
+	Writer.AddLongArray(Value);
 }
 void ULowEntryBitDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Value)
 {
 	int64 Size = Value.Num();
 	if ((Size <= 0) || (Size > 0x7fffffff))
 	{
-		AddUinteger(0);
+		Writer.AddUinteger(0);
 		return;
 	}
-	AddUinteger(Size);
+	Writer.AddUinteger(Size);
 	for (ULowEntryLong* V : Value)
 	{
 		AddLongBytes(V);
@@ -660,41 +353,21 @@ void ULowEntryBitDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Val
 }
 void ULowEntryBitDataWriter::AddFloatArray(const TArray<float>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (float V : Value)
-	{
-		AddFloat(V);
-	}
+	Writer.AddFloatArray(Value);
 }
 void ULowEntryBitDataWriter::AddDoubleArray(const TArray<double>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (double V : Value)
-	{
-		AddDouble(V);
-	}
+	Writer.AddDoubleArray(Value);
 }
 void ULowEntryBitDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>& Value)
 {
 	int64 Size = Value.Num();
 	if ((Size <= 0) || (Size > 0x7fffffff))
 	{
-		AddUinteger(0);
+		Writer.AddUinteger(0);
 		return;
 	}
-	AddUinteger(Size);
+	Writer.AddUinteger(Size);
 	for (ULowEntryDouble* V : Value)
 	{
 		AddDoubleBytes(V);
@@ -702,29 +375,17 @@ void ULowEntryBitDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>&
 }
 void ULowEntryBitDataWriter::AddBooleanArray(const TArray<bool>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (bool V : Value)
-	{
-		AddBoolean(V);
-	}
+	Writer.AddBooleanArray(Value);
 }
 void ULowEntryBitDataWriter::AddStringUtf8Array(const TArray<FString>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (const FString& V : Value)
-	{
-		AddStringUtf8(V);
-	}
+	Writer.AddStringUtf8Array(Value);
+}
+void ULowEntryBitDataWriter::AddIntegerArrayDelta(const TArray<int32>& Value)
+{
+	Writer.AddIntegerArrayDelta(Value);
+}
+void ULowEntryBitDataWriter::AddLongArrayDelta(const TArray<int64>& Value)
+{
+	Writer.AddLongArrayDelta(Value);
 }
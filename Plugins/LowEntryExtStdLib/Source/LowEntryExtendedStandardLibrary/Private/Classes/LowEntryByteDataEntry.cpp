@@ -3,14 +3,24 @@
 #include "LowEntryByteDataEntry.h"
 
 
+namespace LowEntryByteDataEntry
+{
+	template<typename T>
+	TArray<T*> CastObjects(const TArray<UObject*>& Objects)
+	{
+		TArray<T*> Result;
+		Result.Reserve(Objects.Num());
+		for (UObject* Object : Objects)
+		{
+			Result.Add(Cast<T>(Object));
+		}
+		return Result;
+	}
+}
+
+
 ULowEntryByteDataEntry::ULowEntryByteDataEntry(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
-	, ByteValue(0)
-	, IntegerValue(0)
-	, LongValue(0)
-	, FloatValue(0)
-	, DoubleValue(0)
-	, BooleanValue(false) {}
+	: Super(ObjectInitializer) {}
 
 ULowEntryByteDataEntry* ULowEntryByteDataEntry::CreateFromByte(const uint8 Value)
 {
@@ -171,11 +181,12 @@ bool ULowEntryByteDataEntry::IsByte()
 void ULowEntryByteDataEntry::SetByte(const uint8 Value)
 {
 	Type = 1;
-	ByteValue = Value;
+	ObjectValues.Empty();
+	Storage.SetByte(Value);
 }
 uint8 ULowEntryByteDataEntry::GetByte()
 {
-	return ByteValue;
+	return Storage.GetByte();
 }
 
 bool ULowEntryByteDataEntry::IsInteger()
@@ -185,11 +196,12 @@ bool ULowEntryByteDataEntry::IsInteger()
 void ULowEntryByteDataEntry::SetInteger(const int32 Value)
 {
 	Type = 2;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryByteDataEntry::GetInteger()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger1()
@@ -199,11 +211,12 @@ bool ULowEntryByteDataEntry::IsPositiveInteger1()
 void ULowEntryByteDataEntry::SetPositiveInteger1(const int32 Value)
 {
 	Type = 8;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryByteDataEntry::GetPositiveInteger1()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger2()
@@ -213,11 +226,12 @@ bool ULowEntryByteDataEntry::IsPositiveInteger2()
 void ULowEntryByteDataEntry::SetPositiveInteger2(const int32 Value)
 {
 	Type = 9;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryByteDataEntry::GetPositiveInteger2()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger3()
@@ -227,11 +241,12 @@ bool ULowEntryByteDataEntry::IsPositiveInteger3()
 void ULowEntryByteDataEntry::SetPositiveInteger3(const int32 Value)
 {
 	Type = 10;
-	IntegerValue = Value;
+	ObjectValues.Empty();
+	Storage.SetInteger(Value);
 }
 int32 ULowEntryByteDataEntry::GetPositiveInteger3()
 {
-	return IntegerValue;
+	return Storage.GetInteger();
 }
 
 bool ULowEntryByteDataEntry::IsLong()
@@ -241,11 +256,12 @@ bool ULowEntryByteDataEntry::IsLong()
 void ULowEntryByteDataEntry::SetLong(const int64 Value)
 {
 	Type = 11;
-	LongValue = Value;
+	ObjectValues.Empty();
+	Storage.SetLong(Value);
 }
 int64 ULowEntryByteDataEntry::GetLong()
 {
-	return LongValue;
+	return Storage.GetLong();
 }
 
 bool ULowEntryByteDataEntry::IsLongBytes()
@@ -255,11 +271,13 @@ bool ULowEntryByteDataEntry::IsLongBytes()
 void ULowEntryByteDataEntry::SetLongBytes(ULowEntryLong* Value)
 {
 	Type = 3;
-	LongBytesValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(1);
+	ObjectValues.Add(Value);
 }
 ULowEntryLong* ULowEntryByteDataEntry::GetLongBytes()
 {
-	return LongBytesValue;
+	return ((ObjectValues.Num() > 0) ? Cast<ULowEntryLong>(ObjectValues[0]) : nullptr);
 }
 
 
@@ -270,11 +288,12 @@ bool ULowEntryByteDataEntry::IsFloat()
 void ULowEntryByteDataEntry::SetFloat(const float Value)
 {
 	Type = 4;
-	FloatValue = Value;
+	ObjectValues.Empty();
+	Storage.SetFloat(Value);
 }
 float ULowEntryByteDataEntry::GetFloat()
 {
-	return FloatValue;
+	return Storage.GetFloat();
 }
 
 bool ULowEntryByteDataEntry::IsDouble()
@@ -284,11 +303,12 @@ bool ULowEntryByteDataEntry::IsDouble()
 void ULowEntryByteDataEntry::SetDouble(const double Value)
 {
 	Type = 16;
-	DoubleValue = Value;
+	ObjectValues.Empty();
+	Storage.SetDouble(Value);
 }
 double ULowEntryByteDataEntry::GetDouble()
 {
-	return DoubleValue;
+	return Storage.GetDouble();
 }
 
 bool ULowEntryByteDataEntry::IsDoubleBytes()
@@ -298,11 +318,13 @@ bool ULowEntryByteDataEntry::IsDoubleBytes()
 void ULowEntryByteDataEntry::SetDoubleBytes(ULowEntryDouble* Value)
 {
 	Type = 5;
-	DoubleBytesValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(1);
+	ObjectValues.Add(Value);
 }
 ULowEntryDouble* ULowEntryByteDataEntry::GetDoubleBytes()
 {
-	return DoubleBytesValue;
+	return ((ObjectValues.Num() > 0) ? Cast<ULowEntryDouble>(ObjectValues[0]) : nullptr);
 }
 
 
@@ -313,11 +335,12 @@ bool ULowEntryByteDataEntry::IsBoolean()
 void ULowEntryByteDataEntry::SetBoolean(const bool Value)
 {
 	Type = 6;
-	BooleanValue = Value;
+	ObjectValues.Empty();
+	Storage.SetBoolean(Value);
 }
 bool ULowEntryByteDataEntry::GetBoolean()
 {
-	return BooleanValue;
+	return Storage.GetBoolean();
 }
 
 bool ULowEntryByteDataEntry::IsStringUtf8()
@@ -327,11 +350,12 @@ bool ULowEntryByteDataEntry::IsStringUtf8()
 void ULowEntryByteDataEntry::SetStringUtf8(const FString& Value)
 {
 	Type = 7;
-	StringUtf8Value = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-FString ULowEntryByteDataEntry::GetStringUtf8()
+const FString& ULowEntryByteDataEntry::GetStringUtf8()
 {
-	return StringUtf8Value;
+	return Storage.GetPayload<FString>();
 }
 
 
@@ -342,11 +366,18 @@ bool ULowEntryByteDataEntry::IsByteArray()
 void ULowEntryByteDataEntry::SetByteArray(const TArray<uint8>& Value)
 {
 	Type = 101;
-	ByteArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetByteArray(TArray<uint8>&& Value)
+{
+	Type = 101;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<uint8> ULowEntryByteDataEntry::GetByteArray()
+const TArray<uint8>& ULowEntryByteDataEntry::GetByteArray()
 {
-	return ByteArrayValue;
+	return Storage.GetPayload<TArray<uint8>>();
 }
 
 bool ULowEntryByteDataEntry::IsIntegerArray()
@@ -356,11 +387,18 @@ bool ULowEntryByteDataEntry::IsIntegerArray()
 void ULowEntryByteDataEntry::SetIntegerArray(const TArray<int32>& Value)
 {
 	Type = 102;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetIntegerArray(TArray<int32>&& Value)
+{
+	Type = 102;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<int32> ULowEntryByteDataEntry::GetIntegerArray()
+const TArray<int32>& ULowEntryByteDataEntry::GetIntegerArray()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger1Array()
@@ -370,11 +408,18 @@ bool ULowEntryByteDataEntry::IsPositiveInteger1Array()
 void ULowEntryByteDataEntry::SetPositiveInteger1Array(const TArray<int32>& Value)
 {
 	Type = 108;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryByteDataEntry::GetPositiveInteger1Array()
+void ULowEntryByteDataEntry::SetPositiveInteger1Array(TArray<int32>&& Value)
 {
-	return IntegerArrayValue;
+	Type = 108;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
+}
+const TArray<int32>& ULowEntryByteDataEntry::GetPositiveInteger1Array()
+{
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger2Array()
@@ -384,11 +429,18 @@ bool ULowEntryByteDataEntry::IsPositiveInteger2Array()
 void ULowEntryByteDataEntry::SetPositiveInteger2Array(const TArray<int32>& Value)
 {
 	Type = 109;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetPositiveInteger2Array(TArray<int32>&& Value)
+{
+	Type = 109;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<int32> ULowEntryByteDataEntry::GetPositiveInteger2Array()
+const TArray<int32>& ULowEntryByteDataEntry::GetPositiveInteger2Array()
 {
-	return IntegerArrayValue;
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryByteDataEntry::IsPositiveInteger3Array()
@@ -398,11 +450,18 @@ bool ULowEntryByteDataEntry::IsPositiveInteger3Array()
 void ULowEntryByteDataEntry::SetPositiveInteger3Array(const TArray<int32>& Value)
 {
 	Type = 110;
-	IntegerArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<int32> ULowEntryByteDataEntry::GetPositiveInteger3Array()
+void ULowEntryByteDataEntry::SetPositiveInteger3Array(TArray<int32>&& Value)
 {
-	return IntegerArrayValue;
+	Type = 110;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
+}
+const TArray<int32>& ULowEntryByteDataEntry::GetPositiveInteger3Array()
+{
+	return Storage.GetPayload<TArray<int32>>();
 }
 
 bool ULowEntryByteDataEntry::IsLongArray()
@@ -412,11 +471,18 @@ bool ULowEntryByteDataEntry::IsLongArray()
 void ULowEntryByteDataEntry::SetLongArray(const TArray<int64>& Value)
 {
 	Type = 111;
-	LongArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetLongArray(TArray<int64>&& Value)
+{
+	Type = 111;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<int64> ULowEntryByteDataEntry::GetLongArray()
+const TArray<int64>& ULowEntryByteDataEntry::GetLongArray()
 {
-	return LongArrayValue;
+	return Storage.GetPayload<TArray<int64>>();
 }
 
 bool ULowEntryByteDataEntry::IsLongBytesArray()
@@ -426,11 +492,20 @@ bool ULowEntryByteDataEntry::IsLongBytesArray()
 void ULowEntryByteDataEntry::SetLongBytesArray(const TArray<ULowEntryLong*>& Value)
 {
 	Type = 103;
-	LongBytesArrayValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
+}
+void ULowEntryByteDataEntry::SetLongBytesArray(TArray<ULowEntryLong*>&& Value)
+{
+	Type = 103;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
 }
 TArray<ULowEntryLong*> ULowEntryByteDataEntry::GetLongBytesArray()
 {
-	return LongBytesArrayValue;
+	return LowEntryByteDataEntry::CastObjects<ULowEntryLong>(ObjectValues);
 }
 
 
@@ -441,11 +516,18 @@ bool ULowEntryByteDataEntry::IsFloatArray()
 void ULowEntryByteDataEntry::SetFloatArray(const TArray<float>& Value)
 {
 	Type = 104;
-	FloatArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
 }
-TArray<float> ULowEntryByteDataEntry::GetFloatArray()
+void ULowEntryByteDataEntry::SetFloatArray(TArray<float>&& Value)
 {
-	return FloatArrayValue;
+	Type = 104;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
+}
+const TArray<float>& ULowEntryByteDataEntry::GetFloatArray()
+{
+	return Storage.GetPayload<TArray<float>>();
 }
 
 bool ULowEntryByteDataEntry::IsDoubleArray()
@@ -455,11 +537,18 @@ bool ULowEntryByteDataEntry::IsDoubleArray()
 void ULowEntryByteDataEntry::SetDoubleArray(const TArray<double>& Value)
 {
 	Type = 116;
-	DoubleArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetDoubleArray(TArray<double>&& Value)
+{
+	Type = 116;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<double> ULowEntryByteDataEntry::GetDoubleArray()
+const TArray<double>& ULowEntryByteDataEntry::GetDoubleArray()
 {
-	return DoubleArrayValue;
+	return Storage.GetPayload<TArray<double>>();
 }
 
 bool ULowEntryByteDataEntry::IsDoubleBytesArray()
@@ -469,11 +558,20 @@ bool ULowEntryByteDataEntry::IsDoubleBytesArray()
 void ULowEntryByteDataEntry::SetDoubleBytesArray(const TArray<ULowEntryDouble*>& Value)
 {
 	Type = 105;
-	DoubleBytesArrayValue = Value;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
+}
+void ULowEntryByteDataEntry::SetDoubleBytesArray(TArray<ULowEntryDouble*>&& Value)
+{
+	Type = 105;
+	Storage.Reset();
+	ObjectValues.Reset(Value.Num());
+	ObjectValues.Append(Value);
 }
 TArray<ULowEntryDouble*> ULowEntryByteDataEntry::GetDoubleBytesArray()
 {
-	return DoubleBytesArrayValue;
+	return LowEntryByteDataEntry::CastObjects<ULowEntryDouble>(ObjectValues);
 }
 
 
@@ -484,11 +582,18 @@ bool ULowEntryByteDataEntry::IsBooleanArray()
 void ULowEntryByteDataEntry::SetBooleanArray(const TArray<bool>& Value)
 {
 	Type = 106;
-	BooleanArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetBooleanArray(TArray<bool>&& Value)
+{
+	Type = 106;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<bool> ULowEntryByteDataEntry::GetBooleanArray()
+const TArray<bool>& ULowEntryByteDataEntry::GetBooleanArray()
 {
-	return BooleanArrayValue;
+	return Storage.GetPayload<TArray<bool>>();
 }
 
 bool ULowEntryByteDataEntry::IsStringUtf8Array()
@@ -498,9 +603,16 @@ bool ULowEntryByteDataEntry::IsStringUtf8Array()
 void ULowEntryByteDataEntry::SetStringUtf8Array(const TArray<FString>& Value)
 {
 	Type = 107;
-	StringUtf8ArrayValue = Value;
+	ObjectValues.Empty();
+	Storage.SetPayload(Value);
+}
+void ULowEntryByteDataEntry::SetStringUtf8Array(TArray<FString>&& Value)
+{
+	Type = 107;
+	ObjectValues.Empty();
+	Storage.SetPayload(MoveTemp(Value));
 }
-TArray<FString> ULowEntryByteDataEntry::GetStringUtf8Array()
+const TArray<FString>& ULowEntryByteDataEntry::GetStringUtf8Array()
 {
-	return StringUtf8ArrayValue;
+	return Storage.GetPayload<TArray<FString>>();
 }
@@ -0,0 +1,287 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteDataSchema.h"
+#include "LowEntryByteDataEntry.h"
+
+
+ULowEntryByteDataSchema::ULowEntryByteDataSchema(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryByteDataSchema* ULowEntryByteDataSchema::Create(const TArray<ULowEntryByteDataEntry*>& Layout)
+{
+	ULowEntryByteDataSchema* Instance = NewObject<ULowEntryByteDataSchema>();
+	Instance->WriteOps.Reserve(Layout.Num());
+	Instance->ReadOps.Reserve(Layout.Num());
+	for (ULowEntryByteDataEntry* Item : Layout)
+	{
+		Instance->WriteOps.Add(GetWriteOp(Item));
+		Instance->ReadOps.Add(GetReadOp(Item));
+	}
+	return Instance;
+}
+
+
+ULowEntryByteDataSchema::FWriteOp ULowEntryByteDataSchema::GetWriteOp(ULowEntryByteDataEntry* Item)
+{
+	if (Item == nullptr)
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) {};
+	}
+
+	if (Item->IsByte())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddByte(Entry->GetByte()); };
+	}
+	if (Item->IsInteger())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddInteger(Entry->GetInteger()); };
+	}
+	if (Item->IsPositiveInteger1())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger1(Entry->GetPositiveInteger1()); };
+	}
+	if (Item->IsPositiveInteger2())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger2(Entry->GetPositiveInteger2()); };
+	}
+	if (Item->IsPositiveInteger3())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger3(Entry->GetPositiveInteger3()); };
+	}
+	if (Item->IsLong())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddLong(Entry->GetLong()); };
+	}
+	if (Item->IsLongBytes())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddLongBytes(Entry->GetLongBytes()); };
+	}
+	if (Item->IsFloat())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddFloat(Entry->GetFloat()); };
+	}
+	if (Item->IsDouble())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddDouble(Entry->GetDouble()); };
+	}
+	if (Item->IsDoubleBytes())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddDoubleBytes(Entry->GetDoubleBytes()); };
+	}
+	if (Item->IsBoolean())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddBoolean(Entry->GetBoolean()); };
+	}
+	if (Item->IsStringUtf8())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddStringUtf8(Entry->GetStringUtf8()); };
+	}
+
+	if (Item->IsByteArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddByteArray(Entry->GetByteArray()); };
+	}
+	if (Item->IsIntegerArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddIntegerArray(Entry->GetIntegerArray()); };
+	}
+	if (Item->IsPositiveInteger1Array())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger1Array(Entry->GetPositiveInteger1Array()); };
+	}
+	if (Item->IsPositiveInteger2Array())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger2Array(Entry->GetPositiveInteger2Array()); };
+	}
+	if (Item->IsPositiveInteger3Array())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddPositiveInteger3Array(Entry->GetPositiveInteger3Array()); };
+	}
+	if (Item->IsLongArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddLongArray(Entry->GetLongArray()); };
+	}
+	if (Item->IsLongBytesArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddLongBytesArray(Entry->GetLongBytesArray()); };
+	}
+	if (Item->IsFloatArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddFloatArray(Entry->GetFloatArray()); };
+	}
+	if (Item->IsDoubleArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddDoubleArray(Entry->GetDoubleArray()); };
+	}
+	if (Item->IsDoubleBytesArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddDoubleBytesArray(Entry->GetDoubleBytesArray()); };
+	}
+	if (Item->IsBooleanArray())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddBooleanArray(Entry->GetBooleanArray()); };
+	}
+	if (Item->IsStringUtf8Array())
+	{
+		return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) { Writer->AddStringUtf8Array(Entry->GetStringUtf8Array()); };
+	}
+
+	return [](ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry) {};
+}
+
+ULowEntryByteDataSchema::FReadOp ULowEntryByteDataSchema::GetReadOp(ULowEntryByteDataEntry* Item)
+{
+	if (Item == nullptr)
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) {};
+	}
+
+	if (Item->IsByte())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetByte(Reader->GetByte()); };
+	}
+	if (Item->IsInteger())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetInteger(Reader->GetInteger()); };
+	}
+	if (Item->IsPositiveInteger1())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger1(Reader->GetPositiveInteger1()); };
+	}
+	if (Item->IsPositiveInteger2())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger2(Reader->GetPositiveInteger2()); };
+	}
+	if (Item->IsPositiveInteger3())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger3(Reader->GetPositiveInteger3()); };
+	}
+	if (Item->IsLong())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetLong(Reader->GetLong()); };
+	}
+	if (Item->IsLongBytes())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetLongBytes(Reader->GetLongBytes()); };
+	}
+	if (Item->IsFloat())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetFloat(Reader->GetFloat()); };
+	}
+	if (Item->IsDouble())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetDouble(Reader->GetDouble()); };
+	}
+	if (Item->IsDoubleBytes())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetDoubleBytes(Reader->GetDoubleBytes()); };
+	}
+	if (Item->IsBoolean())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetBoolean(Reader->GetBoolean()); };
+	}
+	if (Item->IsStringUtf8())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetStringUtf8(Reader->GetStringUtf8()); };
+	}
+
+	if (Item->IsByteArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetByteArray(Reader->GetByteArray()); };
+	}
+	if (Item->IsIntegerArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetIntegerArray(Reader->GetIntegerArray()); };
+	}
+	if (Item->IsPositiveInteger1Array())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger1Array(Reader->GetPositiveInteger1Array()); };
+	}
+	if (Item->IsPositiveInteger2Array())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger2Array(Reader->GetPositiveInteger2Array()); };
+	}
+	if (Item->IsPositiveInteger3Array())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetPositiveInteger3Array(Reader->GetPositiveInteger3Array()); };
+	}
+	if (Item->IsLongArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetLongArray(Reader->GetLongArray()); };
+	}
+	if (Item->IsLongBytesArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetLongBytesArray(Reader->GetLongBytesArray()); };
+	}
+	if (Item->IsFloatArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetFloatArray(Reader->GetFloatArray()); };
+	}
+	if (Item->IsDoubleArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetDoubleArray(Reader->GetDoubleArray()); };
+	}
+	if (Item->IsDoubleBytesArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetDoubleBytesArray(Reader->GetDoubleBytesArray()); };
+	}
+	if (Item->IsBooleanArray())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetBooleanArray(Reader->GetBooleanArray()); };
+	}
+	if (Item->IsStringUtf8Array())
+	{
+		return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) { Entry->SetStringUtf8Array(Reader->GetStringUtf8Array()); };
+	}
+
+	return [](ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry) {};
+}
+
+
+int32 ULowEntryByteDataSchema::GetEntryCount()
+{
+	return WriteOps.Num();
+}
+
+void ULowEntryByteDataSchema::Write(ULowEntryByteDataWriter* ByteDataWriter, const TArray<ULowEntryByteDataEntry*>& Values)
+{
+	if (ByteDataWriter == nullptr)
+	{
+		return;
+	}
+	ULowEntryByteDataEntry* DefaultEntry = GetMutableDefault<ULowEntryByteDataEntry>();
+	const int32 Count = WriteOps.Num();
+	for (int32 i = 0; i < Count; i++)
+	{
+		ULowEntryByteDataEntry* Entry = (Values.IsValidIndex(i) && (Values[i] != nullptr)) ? Values[i] : DefaultEntry;
+		WriteOps[i](ByteDataWriter, Entry);
+	}
+}
+
+TArray<uint8> ULowEntryByteDataSchema::GetBytes(const TArray<ULowEntryByteDataEntry*>& Values)
+{
+	if (CachedWriter == nullptr)
+	{
+		CachedWriter = ULowEntryByteDataWriter::Create();
+	}
+	CachedWriter->Writer.Reset();
+	Write(CachedWriter, Values);
+	return CachedWriter->Writer.GetBytes();
+}
+
+void ULowEntryByteDataSchema::Read(ULowEntryByteDataReader* ByteDataReader, TArray<ULowEntryByteDataEntry*>& Values)
+{
+	if (ByteDataReader == nullptr)
+	{
+		return;
+	}
+	const int32 Count = ReadOps.Num();
+	Values.SetNum(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		if (Values[i] == nullptr)
+		{
+			Values[i] = NewObject<ULowEntryByteDataEntry>();
+		}
+		ReadOps[i](ByteDataReader, Values[i]);
+	}
+}
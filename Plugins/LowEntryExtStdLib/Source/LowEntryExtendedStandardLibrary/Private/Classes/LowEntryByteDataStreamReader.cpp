@@ -0,0 +1,246 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteDataStreamReader.h"
+
+
+ULowEntryByteDataStreamReader::ULowEntryByteDataStreamReader(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Reader(MakeUnique<FLowEntryByteStreamReader>()) {}
+
+ULowEntryByteDataStreamReader* ULowEntryByteDataStreamReader::Create(TUniquePtr<FLowEntryByteStreamReader>&& Reader)
+{
+	if (!Reader.IsValid())
+	{
+		return nullptr;
+	}
+	ULowEntryByteDataStreamReader* Item = NewObject<ULowEntryByteDataStreamReader>();
+	Item->Reader = MoveTemp(Reader);
+	return Item;
+}
+
+ULowEntryByteDataStreamReader* ULowEntryByteDataStreamReader::OpenFile(const FString& FilePath, const int32 ChunkSize)
+{
+	return Create(FLowEntryByteStreamReader::OpenFile(FilePath, ChunkSize));
+}
+
+ULowEntryByteDataStreamReader* ULowEntryByteDataStreamReader::OpenCompressedFile(const FString& FilePath, const int32 ChunkSize)
+{
+	return Create(FLowEntryByteStreamReader::OpenCompressedFile(FilePath, ChunkSize));
+}
+
+void ULowEntryByteDataStreamReader::BeginDestroy()
+{
+	Reader->Close();
+	Super::BeginDestroy();
+}
+
+
+int64 ULowEntryByteDataStreamReader::GetPosition()
+{
+	return Reader->GetPosition();
+}
+
+void ULowEntryByteDataStreamReader::SetPosition(const int64 Position_)
+{
+	Reader->SetPosition(Position_);
+}
+
+void ULowEntryByteDataStreamReader::Reset()
+{
+	Reader->Reset();
+}
+
+void ULowEntryByteDataStreamReader::Empty()
+{
+	Reader->Empty();
+}
+
+int64 ULowEntryByteDataStreamReader::Remaining()
+{
+	return Reader->Remaining();
+}
+
+void ULowEntryByteDataStreamReader::Close()
+{
+	Reader->Close();
+}
+
+
+uint8 ULowEntryByteDataStreamReader::GetByte()
+{
+	return Reader->GetByte();
+}
+
+int32 ULowEntryByteDataStreamReader::GetInteger()
+{
+	return Reader->GetInteger();
+}
+
+int32 ULowEntryByteDataStreamReader::GetPositiveInteger1()
+{
+	return Reader->GetPositiveInteger1();
+}
+
+int32 ULowEntryByteDataStreamReader::GetPositiveInteger2()
+{
+	return Reader->GetPositiveInteger2();
+}
+
+int32 ULowEntryByteDataStreamReader::GetPositiveInteger3()
+{
+	return Reader->GetPositiveInteger3();
+}
+
+int64 ULowEntryByteDataStreamReader::GetLong()
+{
+	return Reader->GetLong();
+}
+
+ULowEntryLong* ULowEntryByteDataStreamReader::GetLongBytes()
+{
+	uint8 Data[8];
+	const int32 Length = Reader->GetRawBytes(Data, 8);
+	return ULowEntryLong::Create(TArray<uint8>(Data, Length));
+}
+
+float ULowEntryByteDataStreamReader::GetFloat()
+{
+	return Reader->GetFloat();
+}
+
+double ULowEntryByteDataStreamReader::GetDouble()
+{
+	return Reader->GetDouble();
+}
+
+ULowEntryDouble* ULowEntryByteDataStreamReader::GetDoubleBytes()
+{
+	uint8 Data[8];
+	const int32 Length = Reader->GetRawBytes(Data, 8);
+	return ULowEntryDouble::Create(TArray<uint8>(Data, Length));
+}
+
+bool ULowEntryByteDataStreamReader::GetBoolean()
+{
+	return Reader->GetBoolean();
+}
+
+FString ULowEntryByteDataStreamReader::GetStringUtf8()
+{
+	return Reader->GetStringUtf8();
+}
+
+int32 ULowEntryByteDataStreamReader::GetVarInteger()
+{
+	return Reader->GetVarInteger();
+}
+
+int64 ULowEntryByteDataStreamReader::GetVarLong()
+{
+	return Reader->GetVarLong();
+}
+
+int32 ULowEntryByteDataStreamReader::GetZigZagInteger()
+{
+	return Reader->GetZigZagInteger();
+}
+
+int64 ULowEntryByteDataStreamReader::GetZigZagLong()
+{
+	return Reader->GetZigZagLong();
+}
+
+
+TArray<uint8> ULowEntryByteDataStreamReader::GetByteArray()
+{
+	return Reader->GetByteArray();
+}
+
+TArray<int32> ULowEntryByteDataStreamReader::GetIntegerArray()
+{
+	return Reader->GetIntegerArray();
+}
+
+TArray<int32> ULowEntryByteDataStreamReader::GetPositiveInteger1Array()
+{
+	return Reader->GetPositiveInteger1Array();
+}
+
+TArray<int32> ULowEntryByteDataStreamReader::GetPositiveInteger2Array()
+{
+	return Reader->GetPositiveInteger2Array();
+}
+
+TArray<int32> ULowEntryByteDataStreamReader::GetPositiveInteger3Array()
+{
+	return Reader->GetPositiveInteger3Array();
+}
+
+TArray<int64> ULowEntryByteDataStreamReader::GetLongArray()
+{
+	return Reader->GetLongArray();
+}
+
+TArray<ULowEntryLong*> ULowEntryByteDataStreamReader::GetLongBytesArray()
+{
+	int32 Length = Reader->GetUinteger();
+	Length = FMath::Min(Length, Reader->MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<ULowEntryLong*>();
+	}
+	TArray<ULowEntryLong*> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetLongBytes();
+	}
+	return Array;
+}
+
+TArray<float> ULowEntryByteDataStreamReader::GetFloatArray()
+{
+	return Reader->GetFloatArray();
+}
+
+TArray<double> ULowEntryByteDataStreamReader::GetDoubleArray()
+{
+	return Reader->GetDoubleArray();
+}
+
+TArray<ULowEntryDouble*> ULowEntryByteDataStreamReader::GetDoubleBytesArray()
+{
+	int32 Length = Reader->GetUinteger();
+	Length = FMath::Min(Length, Reader->MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<ULowEntryDouble*>();
+	}
+	TArray<ULowEntryDouble*> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetDoubleBytes();
+	}
+	return Array;
+}
+
+TArray<bool> ULowEntryByteDataStreamReader::GetBooleanArray()
+{
+	return Reader->GetBooleanArray();
+}
+
+TArray<FString> ULowEntryByteDataStreamReader::GetStringUtf8Array()
+{
+	return Reader->GetStringUtf8Array();
+}
+
+TArray<int32> ULowEntryByteDataStreamReader::GetIntegerArrayDelta()
+{
+	return Reader->GetIntegerArrayDelta();
+}
+
+TArray<int64> ULowEntryByteDataStreamReader::GetLongArrayDelta()
+{
+	return Reader->GetLongArrayDelta();
+}
@@ -2,7 +2,10 @@
 
 #include "LowEntryByteDataWriter.h"
 #include "LowEntryByteDataEntry.h"
+#include "LowEntryByteDataSchema.h"
+#include "LowEntryByteRope.h"
 #include "LowEntryExtendedStandardLibrary.h"
+#include "FLowEntryByteCompression.h"
 
 
 ULowEntryByteDataWriter::ULowEntryByteDataWriter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
@@ -14,368 +17,216 @@ ULowEntryByteDataWriter* ULowEntryByteDataWriter::Create()
 ULowEntryByteDataWriter* ULowEntryByteDataWriter::CreateFromEntryArray(const TArray<ULowEntryByteDataEntry*>& Array)
 {
 	ULowEntryByteDataWriter* Instance = NewObject<ULowEntryByteDataWriter>();
-	for (int64 i = 0; i < Array.Num(); i++)
+	for (ULowEntryByteDataEntry* Item : Array)
 	{
-		ULowEntryByteDataEntry* Item = Array[i];
 		if (Item != nullptr)
 		{
-			if (Item->IsByte())
-			{
-				Instance->AddByte(Item->GetByte());
-			}
-			else if (Item->IsInteger())
-			{
-				Instance->AddInteger(Item->GetInteger());
-			}
-			else if (Item->IsPositiveInteger1())
-			{
-				Instance->AddPositiveInteger1(Item->GetPositiveInteger1());
-			}
-			else if (Item->IsPositiveInteger2())
-			{
-				Instance->AddPositiveInteger2(Item->GetPositiveInteger2());
-			}
-			else if (Item->IsPositiveInteger3())
-			{
-				Instance->AddPositiveInteger3(Item->GetPositiveInteger3());
-			}
-			else if (Item->IsLong())
-			{
-				Instance->AddLong(Item->GetLong());
-			}
-			else if (Item->IsLongBytes())
-			{
-				Instance->AddLongBytes(Item->GetLongBytes());
-			}
-			else if (Item->IsFloat())
-			{
-				Instance->AddFloat(Item->GetFloat());
-			}
-			else if (Item->IsDouble())
-			{
-				Instance->AddDouble(Item->GetDouble());
-			}
-			else if (Item->IsDoubleBytes())
-			{
-				Instance->AddDoubleBytes(Item->GetDoubleBytes());
-			}
-			else if (Item->IsBoolean())
-			{
-				Instance->AddBoolean(Item->GetBoolean());
-			}
-			else if (Item->IsStringUtf8())
-			{
-				Instance->AddStringUtf8(Item->GetStringUtf8());
-			}
-
-			else if (Item->IsByteArray())
-			{
-				Instance->AddByteArray(Item->GetByteArray());
-			}
-			else if (Item->IsIntegerArray())
-			{
-				Instance->AddIntegerArray(Item->GetIntegerArray());
-			}
-			else if (Item->IsPositiveInteger1Array())
-			{
-				Instance->AddPositiveInteger1Array(Item->GetPositiveInteger1Array());
-			}
-			else if (Item->IsPositiveInteger2Array())
-			{
-				Instance->AddPositiveInteger2Array(Item->GetPositiveInteger2Array());
-			}
-			else if (Item->IsPositiveInteger3Array())
-			{
-				Instance->AddPositiveInteger3Array(Item->GetPositiveInteger3Array());
-			}
-			else if (Item->IsLongArray())
-			{
-				Instance->AddLongArray(Item->GetLongArray());
-			}
-			else if (Item->IsLongBytesArray())
-			{
-				Instance->AddLongBytesArray(Item->GetLongBytesArray());
-			}
-			else if (Item->IsFloatArray())
-			{
-				Instance->AddFloatArray(Item->GetFloatArray());
-			}
-			else if (Item->IsDoubleArray())
-			{
-				Instance->AddDoubleArray(Item->GetDoubleArray());
-			}
-			else if (Item->IsDoubleBytesArray())
-			{
-				Instance->AddDoubleBytesArray(Item->GetDoubleBytesArray());
-			}
-			else if (Item->IsBooleanArray())
-			{
-				Instance->AddBooleanArray(Item->GetBooleanArray());
-			}
-			else if (Item->IsStringUtf8Array())
-			{
-				Instance->AddStringUtf8Array(Item->GetStringUtf8Array());
-			}
+			ULowEntryByteDataSchema::GetWriteOp(Item)(Instance, Item);
 		}
 	}
 	return Instance;
 }
+ULowEntryByteDataWriter* ULowEntryByteDataWriter::CreateStreaming(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink, const int32 ChunkSize)
+{
+	ULowEntryByteDataWriter* Instance = NewObject<ULowEntryByteDataWriter>();
+	Instance->Writer.SetSink(Sink, ChunkSize);
+	return Instance;
+}
+ULowEntryByteDataWriter* ULowEntryByteDataWriter::OpenFile(const FString& FilePath, const bool Append, const int32 ChunkSize)
+{
+	const TSharedPtr<FLowEntryByteArchiveSink, ESPMode::ThreadSafe> Sink = FLowEntryByteArchiveSink::OpenFile(FilePath, Append);
+	if (!Sink.IsValid())
+	{
+		return nullptr;
+	}
+	return CreateStreaming(Sink, ChunkSize);
+}
+ULowEntryByteDataWriter* ULowEntryByteDataWriter::OpenCompressedFile(const FString& FilePath, const bool Append, const FName& Format, const int32 ChunkSize)
+{
+	const TSharedPtr<FLowEntryByteArchiveSink, ESPMode::ThreadSafe> Sink = FLowEntryByteArchiveSink::OpenFile(FilePath, Append);
+	if (!Sink.IsValid())
+	{
+		return nullptr;
+	}
+	return CreateStreaming(MakeShared<FLowEntryByteCompressionSink, ESPMode::ThreadSafe>(Sink, Format), ChunkSize);
+}
+
+void ULowEntryByteDataWriter::BeginDestroy()
+{
+	// the garbage collector shouldn't wait for a file to be written, so the sink finishes on its own
+	Writer.ReleaseSink();
+	Super::BeginDestroy();
+}
 
 
 void ULowEntryByteDataWriter::AddRawByte(const uint8 Value)
 {
-	Bytes.Add(Value);
+	Writer.AddRawByte(Value);
 }
 
 void ULowEntryByteDataWriter::AddRawBytes(const TArray<uint8>& Value)
 {
-	Bytes.Append(Value);
+	Writer.AddRawBytes(Value);
 }
 
 
 TArray<uint8> ULowEntryByteDataWriter::GetBytes()
 {
-	return Bytes;
+	return Writer.GetBytes();
+}
+
+TArray<uint8> ULowEntryByteDataWriter::TakeBytes()
+{
+	return Writer.TakeBytes();
+}
+
+TArray<uint8> ULowEntryByteDataWriter::TakeCompressedBytes()
+{
+	TArray<uint8> Compressed;
+	FLowEntryByteCompression::Compress(Writer.GetBytes(), Compressed);
+	Writer.Reset();
+	return Compressed;
+}
+
+bool ULowEntryByteDataWriter::Flush()
+{
+	return Writer.Flush();
+}
+
+void ULowEntryByteDataWriter::Reserve(const int32 ByteCount)
+{
+	Writer.Reserve(ByteCount);
 }
 
 
 void ULowEntryByteDataWriter::AddByte(const uint8 Value)
 {
-	AddRawByte(Value);
+	Writer.AddByte(Value);
 }
 void ULowEntryByteDataWriter::AddInteger(const int32 Value)
 {
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.AddInteger(Value);
 }
 void ULowEntryByteDataWriter::AddUinteger(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddUinteger(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger1(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-	}
-	else if (Value < 128)
-	{
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger1(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger2(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 32768)
-	{
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger2(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger3(const int32 Value)
 {
-	if (Value <= 0)
-	{
-		AddRawByte(0);
-		AddRawByte(0);
-		AddRawByte(0);
-	}
-	else if (Value < 8388608)
-	{
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
-	else
-	{
-		AddRawByte((Value >> 24) | (1 << 7));
-		AddRawByte(Value >> 16);
-		AddRawByte(Value >> 8);
-		AddRawByte(Value);
-	}
+	Writer.AddPositiveInteger3(Value);
 }
 void ULowEntryByteDataWriter::AddLong(const int64 Value)
 {
-	AddRawByte(Value >> 56);
-	AddRawByte(Value >> 48);
-	AddRawByte(Value >> 40);
-	AddRawByte(Value >> 32);
-	AddRawByte(Value >> 24);
-	AddRawByte(Value >> 16);
-	AddRawByte(Value >> 8);
-	AddRawByte(Value);
+	Writer.AddLong(Value);
 }
 void ULowEntryByteDataWriter::AddLongBytes(ULowEntryLong* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.AddRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryLong::GetDefaultBytes());
+		Writer.AddRawBytes(ULowEntryLong::GetDefaultBytes());
 	}
 }
 void ULowEntryByteDataWriter::AddFloat(const float Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::FloatToBytes(Value));
+	Writer.AddFloat(Value);
 }
 void ULowEntryByteDataWriter::AddDouble(const double Value)
 {
-	AddRawBytes(ULowEntryExtendedStandardLibrary::DoubleToBytes(Value));
+	Writer.AddDouble(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleBytes(ULowEntryDouble* Value)
 {
 	if (Value != nullptr)
 	{
-		AddRawBytes(Value->Bytes);
+		Writer.AddRawBytes(Value->Bytes);
 	}
 	else
 	{
-		AddRawBytes(ULowEntryDouble::GetDefaultBytes());
+		Writer.AddRawBytes(ULowEntryDouble::GetDefaultBytes());
 	}
 }
 void ULowEntryByteDataWriter::AddBoolean(const bool Value)
 {
-	if (Value)
-	{
-		AddRawByte(0x01);
-	}
-	else
-	{
-		AddRawByte(0x00);
-	}
+	Writer.AddBoolean(Value);
 }
 void ULowEntryByteDataWriter::AddStringUtf8(const FString& Value)
 {
-	AddByteArray(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Value));
+	Writer.AddStringUtf8(Value);
+}
+void ULowEntryByteDataWriter::AddVarInteger(const int32 Value)
+{
+	Writer.AddVarInteger(Value);
+}
+void ULowEntryByteDataWriter::AddVarLong(const int64 Value)
+{
+	Writer.AddVarLong(Value);
+}
+void ULowEntryByteDataWriter::AddZigZagInteger(const int32 Value)
+{
+	Writer.AddZigZagInteger(Value);
+}
+void ULowEntryByteDataWriter::AddZigZagLong(const int64 Value)
+{
+	Writer.AddZigZagLong(Value);
 }
 
 
 void ULowEntryByteDataWriter::AddByteArray(const TArray<uint8>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	AddRawBytes(Value);
+	Writer.AddByteArray(Value);
 }
-void ULowEntryByteDataWriter::AddIntegerArray(const TArray<int32>& Value)
+void ULowEntryByteDataWriter::AddByteRope(ULowEntryByteRope* Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
+	if (Value != nullptr)
 	{
-		AddUinteger(0);
-		return;
+		Writer.AddByteArray(Value->Chain);
 	}
-	AddUinteger(Size);
-	for (int32 V : Value)
+	else
 	{
-		AddInteger(V);
+		Writer.AddUinteger(0);
 	}
 }
+void ULowEntryByteDataWriter::AddIntegerArray(const TArray<int32>& Value)
+{
+	Writer.AddIntegerArray(Value);
+}
 void ULowEntryByteDataWriter::AddPositiveInteger1Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger1(V);
-	}
+	Writer.AddPositiveInteger1Array(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger2Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger2(V);
-	}
+	Writer.AddPositiveInteger2Array(Value);
 }
 void ULowEntryByteDataWriter::AddPositiveInteger3Array(const TArray<int32>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int32 V : Value)
-	{
-		AddPositiveInteger3(V);
-	}
+	Writer.AddPositiveInteger3Array(Value);
 }
 void ULowEntryByteDataWriter::AddLongArray(const TArray<int64>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (int64 V : Value)
-	{
-		AddLong(V);
-	}
+	Writer.AddLongArray(Value);
 }
 void ULowEntryByteDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Value)
 {
 	int64 Size = Value.Num();
 	if ((Size <= 0) || (Size > 0x7fffffff))
 	{
-		AddUinteger(0);
+		Writer.AddUinteger(0);
 		return;
 	}
-	AddUinteger(Size);
+	Writer.AddUinteger(Size);
 	for (ULowEntryLong* V : Value)
 	{
 		AddLongBytes(V);
@@ -383,41 +234,21 @@ void ULowEntryByteDataWriter::AddLongBytesArray(const TArray<ULowEntryLong*>& Va
 }
 void ULowEntryByteDataWriter::AddFloatArray(const TArray<float>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (float V : Value)
-	{
-		AddFloat(V);
-	}
+	Writer.AddFloatArray(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleArray(const TArray<double>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (double V : Value)
-	{
-		AddDouble(V);
-	}
+	Writer.AddDoubleArray(Value);
 }
 void ULowEntryByteDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>& Value)
 {
 	int64 Size = Value.Num();
 	if ((Size <= 0) || (Size > 0x7fffffff))
 	{
-		AddUinteger(0);
+		Writer.AddUinteger(0);
 		return;
 	}
-	AddUinteger(Size);
+	Writer.AddUinteger(Size);
 	for (ULowEntryDouble* V : Value)
 	{
 		AddDoubleBytes(V);
@@ -425,45 +256,17 @@ void ULowEntryByteDataWriter::AddDoubleBytesArray(const TArray<ULowEntryDouble*>
 }
 void ULowEntryByteDataWriter::AddBooleanArray(const TArray<bool>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	uint8 B = 0;
-	int32 BIndex = 0;
-	for (bool V : Value)
-	{
-		if (V)
-		{
-			B |= (1 << (7 - BIndex));
-		}
-		BIndex++;
-		if (BIndex == 8)
-		{
-			AddRawByte(B);
-			B = 0;
-			BIndex = 0;
-		}
-	}
-	if (BIndex > 0)
-	{
-		AddRawByte(B);
-	}
+	Writer.AddBooleanArray(Value);
 }
 void ULowEntryByteDataWriter::AddStringUtf8Array(const TArray<FString>& Value)
 {
-	int64 Size = Value.Num();
-	if ((Size <= 0) || (Size > 0x7fffffff))
-	{
-		AddUinteger(0);
-		return;
-	}
-	AddUinteger(Size);
-	for (const FString& V : Value)
-	{
-		AddStringUtf8(V);
-	}
+	Writer.AddStringUtf8Array(Value);
+}
+void ULowEntryByteDataWriter::AddIntegerArrayDelta(const TArray<int32>& Value)
+{
+	Writer.AddIntegerArrayDelta(Value);
+}
+void ULowEntryByteDataWriter::AddLongArrayDelta(const TArray<int64>& Value)
+{
+	Writer.AddLongArrayDelta(Value);
 }
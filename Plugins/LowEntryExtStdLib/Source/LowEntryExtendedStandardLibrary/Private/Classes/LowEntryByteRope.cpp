@@ -0,0 +1,91 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryByteRope.h"
+
+
+ULowEntryByteRope::ULowEntryByteRope(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryByteRope* ULowEntryByteRope::Create()
+{
+	return NewObject<ULowEntryByteRope>();
+}
+
+ULowEntryByteRope* ULowEntryByteRope::Create(FLowEntryByteChain&& Chain)
+{
+	ULowEntryByteRope* Instance = NewObject<ULowEntryByteRope>();
+	Instance->Chain = MoveTemp(Chain);
+	return Instance;
+}
+
+
+void ULowEntryByteRope::Append(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	if (Index < 0)
+	{
+		Length += Index;
+		Index = 0;
+	}
+	if (Length > (ByteArray.Num() - Index))
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return;
+	}
+	Chain.Append(TArrayView<const uint8>(ByteArray.GetData() + Index, Length));
+}
+
+void ULowEntryByteRope::Prepend(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	if (Index < 0)
+	{
+		Length += Index;
+		Index = 0;
+	}
+	if (Length > (ByteArray.Num() - Index))
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return;
+	}
+	Chain.Prepend(TArrayView<const uint8>(ByteArray.GetData() + Index, Length));
+}
+
+void ULowEntryByteRope::AppendRope(ULowEntryByteRope* Rope)
+{
+	if (Rope != nullptr)
+	{
+		Chain.Append(Rope->Chain);
+	}
+}
+
+void ULowEntryByteRope::PrependRope(ULowEntryByteRope* Rope)
+{
+	if (Rope != nullptr)
+	{
+		Chain.Prepend(Rope->Chain);
+	}
+}
+
+ULowEntryByteRope* ULowEntryByteRope::Slice(const int32 Index, const int32 Length) const
+{
+	return Create(Chain.Slice(Index, Length));
+}
+
+TArray<uint8> ULowEntryByteRope::GetBytes() const
+{
+	return Chain.Flatten();
+}
+
+int32 ULowEntryByteRope::GetLength() const
+{
+	return static_cast<int32>(FMath::Min<int64>(Chain.Num(), 0x7FFFFFFF));
+}
+
+void ULowEntryByteRope::Clear()
+{
+	Chain.Reset();
+}
@@ -0,0 +1,504 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryCodecLibrary.h"
+
+#if PLATFORM_ALWAYS_HAS_SSE4_1
+	#include <smmintrin.h>
+	#define LOWENTRY_CODEC_SSE 1
+#endif
+
+#ifndef LOWENTRY_CODEC_SSE
+	#define LOWENTRY_CODEC_SSE 0
+#endif
+
+
+namespace LowEntryCodecLibrary
+{
+	const uint8 INVALID = 0xFF;
+
+	const char BASE64_CHARS[64] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+	const char BASE64URL_CHARS[64] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '_'};
+	const char HEX_CHARS[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+	/** The decoded values of the characters, INVALID for characters that can't be decoded. Characters above 255 are always invalid. */
+	struct FDecodeTables
+	{
+		uint8 Base64[256];
+		uint8 Base64Url[256];
+		uint8 Hex[256];
+
+		FDecodeTables()
+		{
+			FMemory::Memset(Base64, INVALID, sizeof(Base64));
+			FMemory::Memset(Base64Url, INVALID, sizeof(Base64Url));
+			FMemory::Memset(Hex, INVALID, sizeof(Hex));
+			for (int32 i = 0; i < 64; i++)
+			{
+				Base64[static_cast<uint8>(BASE64_CHARS[i])] = static_cast<uint8>(i);
+				Base64Url[static_cast<uint8>(BASE64_CHARS[i])] = static_cast<uint8>(i);
+				Base64Url[static_cast<uint8>(BASE64URL_CHARS[i])] = static_cast<uint8>(i);
+			}
+			for (int32 i = 0; i < 16; i++)
+			{
+				Hex[static_cast<uint8>(HEX_CHARS[i])] = static_cast<uint8>(i);
+				Hex[static_cast<uint8>(FChar::ToLower(HEX_CHARS[i]))] = static_cast<uint8>(i);
+			}
+		}
+	};
+
+	const FDecodeTables& GetDecodeTables()
+	{
+		static const FDecodeTables Tables;
+		return Tables;
+	}
+
+	/** The 8 bit characters of every byte, so a byte can be written with a single copy. */
+	struct FBinaryTables
+	{
+		TCHAR MostSignificantBitFirst[256][8];
+		TCHAR LeastSignificantBitFirst[256][8];
+
+		FBinaryTables()
+		{
+			for (int32 i = 0; i < 256; i++)
+			{
+				for (int32 Bit = 0; Bit < 8; Bit++)
+				{
+					MostSignificantBitFirst[i][Bit] = (((i >> (7 - Bit)) & 1) != 0) ? TEXT('1') : TEXT('0');
+					LeastSignificantBitFirst[i][Bit] = (((i >> Bit) & 1) != 0) ? TEXT('1') : TEXT('0');
+				}
+			}
+		}
+	};
+
+	const FBinaryTables& GetBinaryTables()
+	{
+		static const FBinaryTables Tables;
+		return Tables;
+	}
+
+	FORCEINLINE uint8 Lookup(const uint8 Table[256], const TCHAR Char)
+	{
+		const uint32 Value = static_cast<uint32>(Char);
+		return (Value < 256) ? Table[Value] : INVALID;
+	}
+
+#if LOWENTRY_CODEC_SSE
+	/** The SSE paths read and write the characters 8 at a time as 16 bit values. */
+	constexpr bool SSE_CHARS = (sizeof(TCHAR) == 2);
+
+	FORCEINLINE void StoreChars(TCHAR* Dest, const __m128i Chars)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), _mm_unpacklo_epi8(Chars, Zero));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 8), _mm_unpackhi_epi8(Chars, Zero));
+	}
+
+	/** Characters above 255 become 0 or 255, which are invalid in all alphabets. */
+	FORCEINLINE __m128i LoadChars(const TCHAR* Src)
+	{
+		return _mm_packus_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Src)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + 8)));
+	}
+
+	FORCEINLINE __m128i InRange(const __m128i Chars, const char Min, const char Max)
+	{
+		return _mm_and_si128(_mm_cmpgt_epi8(Chars, _mm_set1_epi8(Min - 1)), _mm_cmplt_epi8(Chars, _mm_set1_epi8(Max + 1)));
+	}
+
+	/** Encodes the first 12 bytes of Bytes into 16 characters (W. Muła, D. Lemire). */
+	FORCEINLINE __m128i EncodeBase64Block(__m128i Bytes, const __m128i ShiftTable)
+	{
+		Bytes = _mm_shuffle_epi8(Bytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+		const __m128i High = _mm_mulhi_epu16(_mm_and_si128(Bytes, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+		const __m128i Low = _mm_mullo_epi16(_mm_and_si128(Bytes, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+		const __m128i Indices = _mm_or_si128(High, Low);
+
+		// 0-25 to 13, 26-51 to 0, 52-61 to 1-10, 62 to 11 and 63 to 12, which then selects the offset from the index to the character
+		__m128i Shift = _mm_subs_epu8(Indices, _mm_set1_epi8(51));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), Indices), _mm_set1_epi8(13)));
+		return _mm_add_epi8(_mm_shuffle_epi8(ShiftTable, Shift), Indices);
+	}
+
+	/** Decodes 16 characters into the first 12 bytes of Bytes, returns false if any of the characters is invalid. */
+	FORCEINLINE bool DecodeBase64Block(const __m128i Chars, const bool Url, __m128i& Bytes)
+	{
+		const __m128i Upper = InRange(Chars, 'A', 'Z');
+		const __m128i Lower = InRange(Chars, 'a', 'z');
+		const __m128i Digit = InRange(Chars, '0', '9');
+		const __m128i Plus = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('+'));
+		const __m128i Slash = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('/'));
+
+		__m128i Valid = _mm_or_si128(_mm_or_si128(Upper, Lower), _mm_or_si128(Digit, _mm_or_si128(Plus, Slash)));
+		__m128i Shift = _mm_or_si128(_mm_and_si128(Upper, _mm_set1_epi8(0 - 'A')), _mm_and_si128(Lower, _mm_set1_epi8(26 - 'a')));
+		Shift = _mm_or_si128(Shift, _mm_and_si128(Digit, _mm_set1_epi8(52 - '0')));
+		Shift = _mm_or_si128(Shift, _mm_or_si128(_mm_and_si128(Plus, _mm_set1_epi8(62 - '+')), _mm_and_si128(Slash, _mm_set1_epi8(63 - '/'))));
+		if (Url)
+		{
+			const __m128i Minus = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('-'));
+			const __m128i Underscore = _mm_cmpeq_epi8(Chars, _mm_set1_epi8('_'));
+			Valid = _mm_or_si128(Valid, _mm_or_si128(Minus, Underscore));
+			Shift = _mm_or_si128(Shift, _mm_or_si128(_mm_and_si128(Minus, _mm_set1_epi8(62 - '-')), _mm_and_si128(Underscore, _mm_set1_epi8(63 - '_'))));
+		}
+		if (_mm_movemask_epi8(Valid) != 0xFFFF)
+		{
+			return false;
+		}
+
+		const __m128i Values = _mm_add_epi8(Chars, Shift);
+		const __m128i Pairs = _mm_maddubs_epi16(Values, _mm_set1_epi32(0x01400140));
+		const __m128i Quads = _mm_madd_epi16(Pairs, _mm_set1_epi32(0x00011000));
+		Bytes = _mm_shuffle_epi8(Quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		return true;
+	}
+#endif
+}
+
+
+TCHAR* ULowEntryCodecLibrary::AllocateChars(FString& String, const int32 Length)
+{
+	TArray<TCHAR>& Chars = String.GetCharArray();
+	if (Length <= 0)
+	{
+		Chars.Empty();
+		return nullptr;
+	}
+	Chars.SetNumUninitialized(Length + 1);
+	Chars[Length] = TEXT('\0');
+	return Chars.GetData();
+}
+
+
+FString ULowEntryCodecLibrary::EncodeBase64(const uint8* Bytes, const int32 Length, const bool Url)
+{
+	FString String;
+	if (Length <= 0)
+	{
+		return String;
+	}
+
+	const int32 FullBlocks = Length / 3;
+	const int32 Remaining = Length - (FullBlocks * 3);
+	const int32 CharCount = (FullBlocks * 4) + ((Remaining <= 0) ? 0 : (Url ? (Remaining + 1) : 4));
+	TCHAR* Dest = AllocateChars(String, CharCount);
+	const char* Alphabet = Url ? LowEntryCodecLibrary::BASE64URL_CHARS : LowEntryCodecLibrary::BASE64_CHARS;
+
+	int32 i = 0;
+#if LOWENTRY_CODEC_SSE
+	if constexpr (LowEntryCodecLibrary::SSE_CHARS)
+	{
+		const __m128i ShiftTable = Url ? _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0) : _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+		for (; (i + 16) <= Length; i += 12)
+		{
+			LowEntryCodecLibrary::StoreChars(Dest, LowEntryCodecLibrary::EncodeBase64Block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Bytes + i)), ShiftTable));
+			Dest += 16;
+		}
+	}
+#endif
+	for (; (i + 3) <= Length; i += 3)
+	{
+		const uint32 Value = (static_cast<uint32>(Bytes[i]) << 16) | (static_cast<uint32>(Bytes[i + 1]) << 8) | Bytes[i + 2];
+		Dest[0] = Alphabet[(Value >> 18) & 0x3F];
+		Dest[1] = Alphabet[(Value >> 12) & 0x3F];
+		Dest[2] = Alphabet[(Value >> 6) & 0x3F];
+		Dest[3] = Alphabet[Value & 0x3F];
+		Dest += 4;
+	}
+	if (Remaining > 0)
+	{
+		const uint32 Value = (static_cast<uint32>(Bytes[i]) << 16) | ((Remaining > 1) ? (static_cast<uint32>(Bytes[i + 1]) << 8) : 0);
+		Dest[0] = Alphabet[(Value >> 18) & 0x3F];
+		Dest[1] = Alphabet[(Value >> 12) & 0x3F];
+		if (Remaining > 1)
+		{
+			Dest[2] = Alphabet[(Value >> 6) & 0x3F];
+		}
+		if (!Url)
+		{
+			if (Remaining <= 1)
+			{
+				Dest[2] = TEXT('=');
+			}
+			Dest[3] = TEXT('=');
+		}
+	}
+	return String;
+}
+
+bool ULowEntryCodecLibrary::DecodeBase64(const TCHAR* Chars, int32 Length, const bool Url, TArray<uint8>& Bytes)
+{
+	Bytes.Reset();
+	while ((Length > 0) && (Chars[Length - 1] == TEXT('=')))
+	{
+		Length--;
+	}
+	if ((Length <= 0) || ((Length % 4) == 1))
+	{
+		return (Length <= 0);
+	}
+
+	const int32 Remaining = Length % 4;
+	Bytes.SetNumUninitialized(((Length / 4) * 3) + ((Remaining > 0) ? (Remaining - 1) : 0));
+	uint8* Dest = Bytes.GetData();
+	const uint8* Table = Url ? LowEntryCodecLibrary::GetDecodeTables().Base64Url : LowEntryCodecLibrary::GetDecodeTables().Base64;
+
+	int32 i = 0;
+#if LOWENTRY_CODEC_SSE
+	if constexpr (LowEntryCodecLibrary::SSE_CHARS)
+	{
+		// stores 16 bytes of which 12 are used, so stop while there are still at least 6 bytes left after the block
+		for (; (i + 24) <= Length; i += 16)
+		{
+			__m128i Block;
+			if (!LowEntryCodecLibrary::DecodeBase64Block(LowEntryCodecLibrary::LoadChars(Chars + i), Url, Block))
+			{
+				break;
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), Block);
+			Dest += 12;
+		}
+	}
+#endif
+	for (; (i + 4) <= Length; i += 4)
+	{
+		const uint8 A = LowEntryCodecLibrary::Lookup(Table, Chars[i]);
+		const uint8 B = LowEntryCodecLibrary::Lookup(Table, Chars[i + 1]);
+		const uint8 C = LowEntryCodecLibrary::Lookup(Table, Chars[i + 2]);
+		const uint8 D = LowEntryCodecLibrary::Lookup(Table, Chars[i + 3]);
+		if ((A | B | C | D) == LowEntryCodecLibrary::INVALID)
+		{
+			Bytes.Reset();
+			return false;
+		}
+		const uint32 Value = (static_cast<uint32>(A) << 18) | (static_cast<uint32>(B) << 12) | (static_cast<uint32>(C) << 6) | D;
+		Dest[0] = static_cast<uint8>(Value >> 16);
+		Dest[1] = static_cast<uint8>(Value >> 8);
+		Dest[2] = static_cast<uint8>(Value);
+		Dest += 3;
+	}
+	if (Remaining > 0)
+	{
+		const uint8 A = LowEntryCodecLibrary::Lookup(Table, Chars[i]);
+		const uint8 B = LowEntryCodecLibrary::Lookup(Table, Chars[i + 1]);
+		const uint8 C = (Remaining > 2) ? LowEntryCodecLibrary::Lookup(Table, Chars[i + 2]) : 0;
+		if ((A | B | C) == LowEntryCodecLibrary::INVALID)
+		{
+			Bytes.Reset();
+			return false;
+		}
+		const uint32 Value = (static_cast<uint32>(A) << 18) | (static_cast<uint32>(B) << 12) | (static_cast<uint32>(C) << 6);
+		Dest[0] = static_cast<uint8>(Value >> 16);
+		if (Remaining > 2)
+		{
+			Dest[1] = static_cast<uint8>(Value >> 8);
+		}
+	}
+	return true;
+}
+
+FString ULowEntryCodecLibrary::ConvertBase64(const FString& String, const bool ToUrl)
+{
+	const TCHAR* Src = *String;
+	const int32 Length = String.Len();
+
+	FString Result;
+	TCHAR* Dest = AllocateChars(Result, Length);
+	int32 Count = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		const TCHAR Char = Src[i];
+		if (ToUrl)
+		{
+			if (Char != TEXT('='))
+			{
+				Dest[Count++] = (Char == TEXT('+')) ? TEXT('-') : ((Char == TEXT('/')) ? TEXT('_') : Char);
+			}
+		}
+		else
+		{
+			Dest[Count++] = (Char == TEXT('-')) ? TEXT('+') : ((Char == TEXT('_')) ? TEXT('/') : Char);
+		}
+	}
+	if (Count < Length)
+	{
+		AllocateChars(Result, Count);
+	}
+	return Result;
+}
+
+
+FString ULowEntryCodecLibrary::EncodeHex(const uint8* Bytes, const int32 Length, const bool AddSpaces)
+{
+	FString String;
+	if (Length <= 0)
+	{
+		return String;
+	}
+
+	TCHAR* Dest = AllocateChars(String, AddSpaces ? ((Length * 3) - 1) : (Length * 2));
+	const char* Alphabet = LowEntryCodecLibrary::HEX_CHARS;
+
+	if (AddSpaces)
+	{
+		for (int32 i = 0; i < Length; i++)
+		{
+			if (i > 0)
+			{
+				*Dest++ = TEXT(' ');
+			}
+			Dest[0] = Alphabet[Bytes[i] >> 4];
+			Dest[1] = Alphabet[Bytes[i] & 0x0F];
+			Dest += 2;
+		}
+		return String;
+	}
+
+	int32 i = 0;
+#if LOWENTRY_CODEC_SSE
+	if constexpr (LowEntryCodecLibrary::SSE_CHARS)
+	{
+		const __m128i Table = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+		const __m128i Mask = _mm_set1_epi8(0x0F);
+		for (; (i + 16) <= Length; i += 16)
+		{
+			const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Bytes + i));
+			const __m128i High = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(Block, 4), Mask));
+			const __m128i Low = _mm_shuffle_epi8(Table, _mm_and_si128(Block, Mask));
+			LowEntryCodecLibrary::StoreChars(Dest, _mm_unpacklo_epi8(High, Low));
+			LowEntryCodecLibrary::StoreChars(Dest + 16, _mm_unpackhi_epi8(High, Low));
+			Dest += 32;
+		}
+	}
+#endif
+	for (; i < Length; i++)
+	{
+		Dest[0] = Alphabet[Bytes[i] >> 4];
+		Dest[1] = Alphabet[Bytes[i] & 0x0F];
+		Dest += 2;
+	}
+	return String;
+}
+
+bool ULowEntryCodecLibrary::DecodeHex(const TCHAR* Chars, const int32 Length, TArray<uint8>& Bytes)
+{
+	Bytes.Reset();
+	const uint8* Table = LowEntryCodecLibrary::GetDecodeTables().Hex;
+
+	int32 Count = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		if (Chars[i] == TEXT(' '))
+		{
+			continue;
+		}
+		if (LowEntryCodecLibrary::Lookup(Table, Chars[i]) == LowEntryCodecLibrary::INVALID)
+		{
+			return false;
+		}
+		Count++;
+	}
+	if (Count <= 0)
+	{
+		return true;
+	}
+
+	Bytes.SetNumUninitialized((Count + 1) / 2);
+	uint8* Dest = Bytes.GetData();
+	bool High = ((Count % 2) == 0);
+	if (!High)
+	{
+		// an odd amount of digits, the first digit is the low nibble of the first byte
+		Dest[0] = 0;
+	}
+	for (int32 i = 0; i < Length; i++)
+	{
+		if (Chars[i] == TEXT(' '))
+		{
+			continue;
+		}
+		const uint8 Value = LowEntryCodecLibrary::Lookup(Table, Chars[i]);
+		if (High)
+		{
+			*Dest = static_cast<uint8>(Value << 4);
+		}
+		else
+		{
+			*Dest++ |= Value;
+		}
+		High = !High;
+	}
+	return true;
+}
+
+
+FString ULowEntryCodecLibrary::EncodeBinary(const uint8* Bytes, const int32 Length, const bool AddSpaces, const bool LeastSignificantBitFirst)
+{
+	FString String;
+	if (Length <= 0)
+	{
+		return String;
+	}
+
+	TCHAR* Dest = AllocateChars(String, AddSpaces ? ((Length * 9) - 1) : (Length * 8));
+	const TCHAR (*Table)[8] = LeastSignificantBitFirst ? LowEntryCodecLibrary::GetBinaryTables().LeastSignificantBitFirst : LowEntryCodecLibrary::GetBinaryTables().MostSignificantBitFirst;
+	for (int32 i = 0; i < Length; i++)
+	{
+		if (AddSpaces && (i > 0))
+		{
+			*Dest++ = TEXT(' ');
+		}
+		FMemory::Memcpy(Dest, Table[Bytes[i]], sizeof(TCHAR) * 8);
+		Dest += 8;
+	}
+	return String;
+}
+
+bool ULowEntryCodecLibrary::DecodeBinary(const TCHAR* Chars, const int32 Length, const bool LeastSignificantBitFirst, TArray<uint8>& Bytes)
+{
+	Bytes.Reset();
+
+	int32 Count = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		const TCHAR Char = Chars[i];
+		if (Char == TEXT(' '))
+		{
+			continue;
+		}
+		if ((Char != TEXT('0')) && (Char != TEXT('1')))
+		{
+			return false;
+		}
+		Count++;
+	}
+	if ((Count % 8) != 0)
+	{
+		return false;
+	}
+	if (Count <= 0)
+	{
+		return true;
+	}
+
+	Bytes.SetNumUninitialized(Count / 8);
+	uint8* Dest = Bytes.GetData();
+	uint8 Value = 0;
+	int32 Bit = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		const TCHAR Char = Chars[i];
+		if (Char == TEXT(' '))
+		{
+			continue;
+		}
+		const uint8 BitValue = (Char == TEXT('1')) ? 1 : 0;
+		Value |= LeastSignificantBitFirst ? (BitValue << Bit) : (BitValue << (7 - Bit));
+		Bit++;
+		if (Bit >= 8)
+		{
+			*Dest++ = Value;
+			Value = 0;
+			Bit = 0;
+		}
+	}
+	return true;
+}
@@ -5,6 +5,10 @@
 #include "LowEntryHashingBCryptLibrary.h"
 #include "LowEntryHashingSha256Library.h"
 #include "LowEntryHashingSha512Library.h"
+#include "LowEntrySha256Hasher.h"
+#include "LowEntrySha512Hasher.h"
+#include "LowEntryHashingHmacLibrary.h"
+#include "LowEntryHmacContext.h"
 #include "LowEntryHashingPearsonLibrary.h"
 #include "LowEntryHashingHashcashLibrary.h"
 
@@ -17,12 +21,16 @@
 #include "LowEntryLatentActionStruct.h"
 
 #include "LowEntryParsedHashcash.h"
+#include "LowEntryHashcashSpentCache.h"
 
 #include "LowEntryByteArray.h"
+#include "LowEntryByteRope.h"
 
 #include "LowEntryByteDataEntry.h"
 #include "LowEntryByteDataReader.h"
+#include "LowEntryByteDataStreamReader.h"
 #include "LowEntryByteDataWriter.h"
+#include "LowEntryByteDataSchema.h"
 
 #include "LowEntryBitDataEntry.h"
 #include "LowEntryBitDataReader.h"
@@ -33,15 +41,29 @@
 
 #include "LowEntryExecutionQueue.h"
 
+#include "LowEntryTexturePool.h"
+
+#include "LowEntryRegex.h"
+#include "LowEntryRegexLibrary.h"
+
+#include "LowEntrySortLibrary.h"
+
+#include "LowEntryCodecLibrary.h"
+#include "LowEntryRandomLibrary.h"
+
 #include "FLowEntryTickFrames.h"
 #include "FLowEntryTickSeconds.h"
 
 #include "FLowEntryDelayFramesAction.h"
 #include "FLowEntryExecutionQueueAction.h"
+#include "FLowEntryHashcashAction.h"
+#include "FLowEntryBCryptAction.h"
+#include "FLowEntryImageAction.h"
+#include "FLowEntryRenderTargetReadbackAction.h"
+#include "FLowEntryPixelOpChain.h"
 
 #include "GenericTeamAgentInterface.h"
 
-#include "Misc/Base64.h"
 #include "Internationalization/Regex.h"
 
 #include "HAL/PlatformApplicationMisc.h"
@@ -689,7 +711,7 @@ void ULowEntryExtendedStandardLibrary::SplitBytes(const TArray<uint8>& ByteArray
 	B.Append(ByteArray.GetData() + LengthA, ByteArray.Num() - LengthA);
 }
 
-TArray<uint8> ULowEntryExtendedStandardLibrary::MergeBytes(TArray<uint8> A, TArray<uint8> B)
+TArray<uint8> ULowEntryExtendedStandardLibrary::MergeBytes(const TArray<uint8>& A, const TArray<uint8>& B)
 {
 	if (A.Num() <= 0)
 	{
@@ -738,6 +760,11 @@ TArray<uint8> ULowEntryExtendedStandardLibrary::BytesSubArray(const TArray<uint8
 	return ReturnArray;
 }
 
+ULowEntryByteRope* ULowEntryExtendedStandardLibrary::ByteRope_Create()
+{
+	return ULowEntryByteRope::Create();
+}
+
 
 void ULowEntryExtendedStandardLibrary::GenerateRandomBytes(const int32 Length, TArray<uint8>& ByteArray)
 {
@@ -747,12 +774,20 @@ void ULowEntryExtendedStandardLibrary::GenerateRandomBytes(const int32 Length, T
 		return;
 	}
 
-	ByteArray.SetNum(Length);
-	for (int32 i = 0; i < Length; i++)
+	ByteArray.SetNumUninitialized(Length);
+	ULowEntryRandomLibrary::SecureRandomBytes(ByteArray.GetData(), Length);
+}
+
+void ULowEntryExtendedStandardLibrary::GenerateRandomBytesFast(const int32 Length, TArray<uint8>& ByteArray)
+{
+	if (Length <= 0)
 	{
-		int32 RandomByte = FMath::Rand() & 0xff;
-		ByteArray[i] = RandomByte;
+		ByteArray.SetNum(0);
+		return;
 	}
+
+	ByteArray.SetNumUninitialized(Length);
+	ULowEntryRandomLibrary::FastRandomBytes(ByteArray.GetData(), Length);
 }
 
 void ULowEntryExtendedStandardLibrary::GenerateRandomBytesRandomLength(int32 MinLength, int32 MaxLength, TArray<uint8>& ByteArray)
@@ -800,12 +835,8 @@ void ULowEntryExtendedStandardLibrary::GenerateRandomBytesRandomLength(int32 Min
 		return;
 	}
 
-	ByteArray.SetNum(Length);
-	for (int32 i = 0; i < Length; i++)
-	{
-		int32 RandomByte = FMath::Rand() & 0xff;
-		ByteArray[i] = RandomByte;
-	}
+	ByteArray.SetNumUninitialized(Length);
+	ULowEntryRandomLibrary::SecureRandomBytes(ByteArray.GetData(), Length);
 }
 
 
@@ -849,11 +880,7 @@ FString ULowEntryExtendedStandardLibrary::BytesToStringUtf8(const TArray<uint8>&
 TArray<uint8> ULowEntryExtendedStandardLibrary::Base64ToBytes(const FString& Base64)
 {
 	TArray<uint8> ByteArray;
-	bool Success = FBase64::Decode(Base64, ByteArray);
-	if (!Success)
-	{
-		return TArray<uint8>();
-	}
+	ULowEntryCodecLibrary::DecodeBase64(*Base64, Base64.Len(), false, ByteArray);
 	return ByteArray;
 }
 
@@ -878,63 +905,56 @@ FString ULowEntryExtendedStandardLibrary::BytesToBase64(const TArray<uint8>& Byt
 		return TEXT("");
 	}
 
-	if ((Index == 0) && (Length == ByteArray.Num()))
-	{
-		return FBase64::Encode(ByteArray);
-	}
-	return FBase64::Encode(BytesSubArray(ByteArray, Index, Length));
+	return ULowEntryCodecLibrary::EncodeBase64(ByteArray.GetData() + Index, Length, false);
 }
 
 
 FString ULowEntryExtendedStandardLibrary::Base64ToBase64Url(const FString& Base64)
 {
-	FString Fixed = Base64;
-	Fixed.ReplaceInline(TEXT("+"), TEXT("-"));
-	Fixed.ReplaceInline(TEXT("/"), TEXT("_"));
-	Fixed.ReplaceInline(TEXT("="), TEXT(""));
-	return Fixed;
+	return ULowEntryCodecLibrary::ConvertBase64(Base64, true);
 }
 
 FString ULowEntryExtendedStandardLibrary::Base64UrlToBase64(const FString& Base64Url)
 {
-	FString Fixed = Base64Url;
-	Fixed.ReplaceInline(TEXT("-"), TEXT("+"));
-	Fixed.ReplaceInline(TEXT("_"), TEXT("/"));
-	return Fixed;
+	return ULowEntryCodecLibrary::ConvertBase64(Base64Url, false);
 }
 
 TArray<uint8> ULowEntryExtendedStandardLibrary::Base64UrlToBytes(const FString& Base64Url)
 {
-	return Base64ToBytes(Base64UrlToBase64(Base64Url));
+	TArray<uint8> ByteArray;
+	ULowEntryCodecLibrary::DecodeBase64(*Base64Url, Base64Url.Len(), true, ByteArray);
+	return ByteArray;
 }
 
 FString ULowEntryExtendedStandardLibrary::BytesToBase64Url(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
 {
-	return Base64ToBase64Url(BytesToBase64(ByteArray, Index, Length));
-}
-
-
-TArray<uint8> ULowEntryExtendedStandardLibrary::HexToBytes(const FString& Hex)
-{
-	FString String = Hex.Replace(TEXT(" "), TEXT(""));
-	if (String.Len() <= 0)
+	if (ByteArray.Num() <= 0)
 	{
-		return TArray<uint8>();
+		return TEXT("");
 	}
 
-	for (const TCHAR c : String)
+	if (Index < 0)
 	{
-		if (!CheckTCharIsHex(c))
-		{
-			return TArray<uint8>();
-		}
+		Length += Index;
+		Index = 0;
 	}
+	if (Length > ByteArray.Num() - Index)
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return TEXT("");
+	}
+
+	return ULowEntryCodecLibrary::EncodeBase64(ByteArray.GetData() + Index, Length, true);
+}
+
 
-	uint8* Bytes = new uint8[String.Len()];
-	int32 ByteCount = ::HexToBytes(String, Bytes);
+TArray<uint8> ULowEntryExtendedStandardLibrary::HexToBytes(const FString& Hex)
+{
 	TArray<uint8> ByteArray;
-	ByteArray.Append(Bytes, ByteCount);
-	delete [] Bytes;
+	ULowEntryCodecLibrary::DecodeHex(*Hex, Hex.Len(), ByteArray);
 	return ByteArray;
 }
 
@@ -959,62 +979,15 @@ FString ULowEntryExtendedStandardLibrary::BytesToHex(const TArray<uint8>& ByteAr
 		return TEXT("");
 	}
 
-	FString Hex = ::BytesToHex(ByteArray.GetData() + Index, Length);
-	if (!AddSpaces)
-	{
-		return Hex;
-	}
-	FString String;
-	String.Reserve((Hex.Len() / 2) * 3);
-	for (int32 i = 1; i <= Hex.Len(); i++)
-	{
-		String.AppendChar(Hex[i - 1]);
-		if (((i % 2) == 0) && (i < (Hex.Len() - 1)))
-		{
-			String.Append(TEXT(" "));
-		}
-	}
-	return String;
+	return ULowEntryCodecLibrary::EncodeHex(ByteArray.GetData() + Index, Length, AddSpaces);
 }
 
 
 TArray<uint8> ULowEntryExtendedStandardLibrary::BinaryToBytes(const FString& Binary)
 {
-	if (Binary.Len() <= 0)
-	{
-		return TArray<uint8>();
-	}
-	FString String = Binary.Replace(TEXT(" "), TEXT(""));
-	if ((String.Len() <= 0) || ((String.Len() % 8) != 0))
-	{
-		return TArray<uint8>();
-	}
-	TArray<uint8> Bytes;
-	Bytes.SetNum(String.Len() / 8);
-	int32 Index = 0;
-	for (int32 i = 0; i < String.Len(); i += 8)
-	{
-		uint8 b = 0;
-		for (int32 j = 0; j < 8; j++)
-		{
-			if (String[i + j] == '0')
-			{
-				continue;
-			}
-			if (String[i + j] == '1')
-			{
-				b += (1 << (7 - j));
-			}
-			else
-			{
-				// encountered invalid character
-				return TArray<uint8>();
-			}
-		}
-		Bytes[Index] = b;
-		Index++;
-	}
-	return Bytes;
+	TArray<uint8> ByteArray;
+	ULowEntryCodecLibrary::DecodeBinary(*Binary, Binary.Len(), false, ByteArray);
+	return ByteArray;
 }
 
 FString ULowEntryExtendedStandardLibrary::BytesToBinary(const TArray<uint8>& ByteArray, const bool AddSpaces, int32 Index, int32 Length)
@@ -1038,67 +1011,15 @@ FString ULowEntryExtendedStandardLibrary::BytesToBinary(const TArray<uint8>& Byt
 		return TEXT("");
 	}
 
-	FString String;
-	String.Reserve(Length * (AddSpaces ? 9 : 8));
-	for (int32 i = 1; i <= Length; i++)
-	{
-		for (int32 j = 7; j >= 0; j--)
-		{
-			if ((ByteArray[Index + (i - 1)] & (1 << j)) > 0)
-			{
-				String.Append(TEXT("1"));
-			}
-			else
-			{
-				String.Append(TEXT("0"));
-			}
-		}
-		if (AddSpaces && (i < Length))
-		{
-			String.Append(TEXT(" "));
-		}
-	}
-	return String;
+	return ULowEntryCodecLibrary::EncodeBinary(ByteArray.GetData() + Index, Length, AddSpaces, false);
 }
 
 
 TArray<uint8> ULowEntryExtendedStandardLibrary::BitStringToBytes(const FString& Binary)
 {
-	if (Binary.Len() <= 0)
-	{
-		return TArray<uint8>();
-	}
-	FString String = Binary.Replace(TEXT(" "), TEXT(""));
-	if ((String.Len() <= 0) || ((String.Len() % 8) != 0))
-	{
-		return TArray<uint8>();
-	}
-	TArray<uint8> Bytes;
-	Bytes.SetNum(String.Len() / 8);
-	int32 Index = 0;
-	for (int32 i = 0; i < String.Len(); i += 8)
-	{
-		uint8 b = 0;
-		for (int32 j = 0; j < 8; j++)
-		{
-			if (String[i + j] == '0')
-			{
-				continue;
-			}
-			if (String[i + j] == '1')
-			{
-				b += (1 << j);
-			}
-			else
-			{
-				// encountered invalid character
-				return TArray<uint8>();
-			}
-		}
-		Bytes[Index] = b;
-		Index++;
-	}
-	return Bytes;
+	TArray<uint8> ByteArray;
+	ULowEntryCodecLibrary::DecodeBinary(*Binary, Binary.Len(), true, ByteArray);
+	return ByteArray;
 }
 
 FString ULowEntryExtendedStandardLibrary::BytesToBitString(const TArray<uint8>& ByteArray, const bool AddSpaces, int32 Index, int32 Length)
@@ -1122,27 +1043,7 @@ FString ULowEntryExtendedStandardLibrary::BytesToBitString(const TArray<uint8>&
 		return TEXT("");
 	}
 
-	FString String;
-	String.Reserve(Length * (AddSpaces ? 9 : 8));
-	for (int32 i = 1; i <= Length; i++)
-	{
-		for (int32 j = 0; j < 8; j++)
-		{
-			if ((ByteArray[Index + (i - 1)] & (1 << j)) > 0)
-			{
-				String.Append(TEXT("1"));
-			}
-			else
-			{
-				String.Append(TEXT("0"));
-			}
-		}
-		if (AddSpaces && (i < Length))
-		{
-			String.Append(TEXT(" "));
-		}
-	}
-	return String;
+	return ULowEntryCodecLibrary::EncodeBinary(ByteArray.GetData() + Index, Length, AddSpaces, true);
 }
 
 
@@ -1493,19 +1394,15 @@ UTexture2D* ULowEntryExtendedStandardLibrary::BytesToImage(const TArray<uint8>&
 		return nullptr;
 	}
 
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
-	if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(ByteArray.GetData() + Index, Length))
-	{
-		return nullptr;
-	}
-
+	int32 Width = 0;
+	int32 Height = 0;
 	TArray<uint8> Uncompressed;
-	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Uncompressed))
+	if (!DecodeImage(*ImageWrapperModule, ByteArray.GetData() + Index, Length, ImageFormat, Width, Height, Uncompressed))
 	{
 		return nullptr;
 	}
 
-	return DataToTexture2D(ImageWrapper->GetWidth(), ImageWrapper->GetHeight(), Uncompressed.GetData(), Uncompressed.Num());
+	return DataToTexture2D(Width, Height, Uncompressed.GetData(), Uncompressed.Num());
 }
 
 UTexture2D* ULowEntryExtendedStandardLibrary::BytesToExistingImage(bool& ReusedGivenTexture2D, UTexture2D* Texture2D, const TArray<uint8>& ByteArray, const ELowEntryImageFormat ImageFormat, int32 Index, int32 Length)
@@ -1538,21 +1435,16 @@ UTexture2D* ULowEntryExtendedStandardLibrary::BytesToExistingImage(bool& ReusedG
 		return nullptr;
 	}
 
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
-	if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(ByteArray.GetData() + Index, Length))
-	{
-		ReusedGivenTexture2D = (Texture2D == nullptr);
-		return nullptr;
-	}
-
+	int32 Width = 0;
+	int32 Height = 0;
 	TArray<uint8> Uncompressed;
-	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Uncompressed))
+	if (!DecodeImage(*ImageWrapperModule, ByteArray.GetData() + Index, Length, ImageFormat, Width, Height, Uncompressed))
 	{
 		ReusedGivenTexture2D = (Texture2D == nullptr);
 		return nullptr;
 	}
 
-	UTexture2D* NewTexture2D = DataToExistingTexture2D(Texture2D, ImageWrapper->GetWidth(), ImageWrapper->GetHeight(), Uncompressed.GetData(), Uncompressed.Num());
+	UTexture2D* NewTexture2D = DataToExistingTexture2D(Texture2D, Width, Height, Uncompressed.GetData(), Uncompressed.Num());
 	ReusedGivenTexture2D = (Texture2D == NewTexture2D);
 	return NewTexture2D;
 }
@@ -1599,77 +1491,98 @@ void ULowEntryExtendedStandardLibrary::BytesToPixels(const TArray<uint8>& ByteAr
 	}
 
 	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
-	if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(ByteArray.GetData() + Index, Length))
-	{
-		return;
-	}
-
+	int32 DataWidth = 0;
+	int32 DataHeight = 0;
 	TArray<uint8> Uncompressed;
-	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Uncompressed))
+	if (!DecodeImage(ImageWrapperModule, ByteArray.GetData() + Index, Length, ImageFormat, DataWidth, DataHeight, Uncompressed))
 	{
 		return;
 	}
 
-	const void* Raw = Uncompressed.GetData();
-	const FColor* DataPixels = static_cast<const FColor*>(Raw);
-	int32 DataWidth = ImageWrapper->GetWidth();
-	int32 DataHeight = ImageWrapper->GetHeight();
-
-	int32 Total = DataWidth * DataHeight;
-	Pixels.SetNum(Total);
-	for (int32 i = 0; i < Total; i++)
-	{
-		Pixels[i] = DataPixels[i];
-	}
+	Pixels = BGRAToPixels(DataWidth, DataHeight, Uncompressed);
 	Width = DataWidth;
 	Height = DataHeight;
 }
 
 void ULowEntryExtendedStandardLibrary::PixelsToBytes(const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, TArray<uint8>& ByteArray, const int32 CompressionQuality)
 {
-	ByteArray = TArray<uint8>();
-
 	//FImageUtils::CompressImageArray(Width, Height, Pixels, ByteArray);
 	//return;
 
+	ByteArray = EncodePixels(FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper")), Width, Height, Pixels, ImageFormat, CompressionQuality);
+}
+
+
+bool ULowEntryExtendedStandardLibrary::DecodeImage(IImageWrapperModule& ImageWrapperModule, const uint8* Data, const int64 Length, const ELowEntryImageFormat ImageFormat, int32& Width, int32& Height, TArray<uint8>& Uncompressed)
+{
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
+	if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(Data, Length))
+	{
+		return false;
+	}
+	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Uncompressed))
+	{
+		return false;
+	}
+	Width = ImageWrapper->GetWidth();
+	Height = ImageWrapper->GetHeight();
+	return true;
+}
+
+TArray<FColor> ULowEntryExtendedStandardLibrary::BGRAToPixels(const int32 Width, const int32 Height, const TArray<uint8>& Uncompressed)
+{
+	TArray<FColor> Pixels;
+	const int32 Total = Width * Height;
+	if ((Total <= 0) || (Uncompressed.Num() < Total * static_cast<int32>(sizeof(FColor))))
+	{
+		return Pixels;
+	}
+	Pixels.SetNumUninitialized(Total);
+	FMemory::Memcpy(Pixels.GetData(), Uncompressed.GetData(), Total * sizeof(FColor));
+	return Pixels;
+}
+
+TArray<uint8> ULowEntryExtendedStandardLibrary::EncodePixels(IImageWrapperModule& ImageWrapperModule, const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, const int32 CompressionQuality)
+{
+	TArray<uint8> ByteArray;
+
 	if ((Width <= 0) || (Height <= 0))
 	{
-		return;
+		return ByteArray;
 	}
 
 	if ((CompressionQuality < 0) || (CompressionQuality > 100))
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, an invalid CompressionQuality (%i) has been given, should be 1-100 or 0 for the default value"), CompressionQuality);
-		return;
+		return ByteArray;
 	}
 
 	int32 Total = Width * Height;
 	if (Total != Pixels.Num())
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, the number of given Pixels (%i) don't match the given Width (%i) x Height (%i) (Width x Height: %i)"), Pixels.Num(), Width, Height, Total);
-		return;
+		return ByteArray;
 	}
 
 	if (ImageFormat == ELowEntryImageFormat::Invalid)
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, Invalid compression is not supported"));
-		return;
+		return ByteArray;
 	}
 	if (ImageFormat == ELowEntryImageFormat::BMP)
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, BMP compression is not supported"));
-		return;
+		return ByteArray;
 	}
 	if (ImageFormat == ELowEntryImageFormat::ICO)
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, ICO compression is not supported"));
-		return;
+		return ByteArray;
 	}
 	if (ImageFormat == ELowEntryImageFormat::ICNS)
 	{
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("in PixelsToBytes, ICNS compression is not supported"));
-		return;
+		return ByteArray;
 	}
 
 	if (ImageFormat == ELowEntryImageFormat::GrayscaleJPEG)
@@ -1681,11 +1594,10 @@ void ULowEntryExtendedStandardLibrary::PixelsToBytes(const int32 Width, const in
 			MutablePixels.Add(static_cast<uint8>(FMath::RoundToDouble((0.2125 * Pixels[i].R) + (0.7154 * Pixels[i].G) + (0.0721 * Pixels[i].B))));
 		}
 
-		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
 		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
 		if (!ImageWrapper.IsValid() || !ImageWrapper->SetRaw(MutablePixels.GetData(), MutablePixels.Num(), Width, Height, ERGBFormat::Gray, 8))
 		{
-			return;
+			return ByteArray;
 		}
 
 		ByteArray = ImageWrapper->GetCompressed(CompressionQuality);
@@ -1700,15 +1612,152 @@ void ULowEntryExtendedStandardLibrary::PixelsToBytes(const int32 Width, const in
 			MutablePixels[i].B = Pixels[i].R;
 		}
 
-		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
 		TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ELowEntryImageFormatToUE4(ImageFormat));
 		if (!ImageWrapper.IsValid() || !ImageWrapper->SetRaw(&MutablePixels[0], MutablePixels.Num() * sizeof(FColor), Width, Height, ERGBFormat::RGBA, 8))
 		{
-			return;
+			return ByteArray;
 		}
 
 		ByteArray = ImageWrapper->GetCompressed(CompressionQuality);
 	}
+	return ByteArray;
+}
+
+
+void ULowEntryExtendedStandardLibrary::BytesToImageAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, UTexture2D*& Texture2D, ULowEntryTexturePool* TexturePool, int32 Index, int32 Length)
+{
+	Texture2D = nullptr;
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryImageAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			struct FResult
+			{
+				bool Success = false;
+				int32 Width = 0;
+				int32 Height = 0;
+				TArray<uint8> Uncompressed;
+			};
+
+			// modules can only be loaded on the game thread
+			IImageWrapperModule* ImageWrapperModule = FModuleManager::LoadModulePtr<IImageWrapperModule>("ImageWrapper");
+			TSharedRef<FResult, ESPMode::ThreadSafe> Result = MakeShared<FResult, ESPMode::ThreadSafe>();
+			TArray<uint8> Bytes = BytesSubArray(ByteArray, Index, Length);
+			TWeakObjectPtr<ULowEntryTexturePool> WeakTexturePool = TexturePool;
+			UTexture2D** Output = &Texture2D;
+
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryImageAction([ImageWrapperModule, Result, Bytes = MoveTemp(Bytes), ImageFormat]()
+			{
+				Result->Success = (ImageWrapperModule != nullptr) && (Bytes.Num() > 0) && DecodeImage(*ImageWrapperModule, Bytes.GetData(), Bytes.Num(), ImageFormat, Result->Width, Result->Height, Result->Uncompressed);
+			}, [Result, WeakTexturePool, Output]()
+			{
+				if (!Result->Success)
+				{
+					*Output = nullptr;
+					return;
+				}
+				UTexture2D* PooledTexture2D = WeakTexturePool.IsValid() ? WeakTexturePool->Take(Result->Width, Result->Height) : nullptr;
+				*Output = DataToExistingTexture2DStreamed(PooledTexture2D, Result->Width, Result->Height, MoveTemp(Result->Uncompressed));
+			}, LatentInfo));
+		}
+	}
+}
+
+void ULowEntryExtendedStandardLibrary::Texture2DToBytesAsync(UObject* WorldContextObject, UTexture2D* Texture2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality)
+{
+	// the pixels are read here, the worker threads shouldn't touch any UObjects
+	int32 Mip0Width = 0;
+	int32 Mip0Height = 0;
+	TArray<FColor> Pixels;
+	if (Texture2D != nullptr)
+	{
+		Texture2DToPixels(Texture2D, Mip0Width, Mip0Height, Pixels);
+	}
+	PixelsToBytesAsync(WorldContextObject, Mip0Width, Mip0Height, Pixels, ImageFormat, LatentInfo, ByteArray, CompressionQuality);
+}
+
+void ULowEntryExtendedStandardLibrary::BytesToPixelsAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels, int32 Index, int32 Length)
+{
+	Width = 0;
+	Height = 0;
+	Pixels = TArray<FColor>();
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryImageAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			struct FResult
+			{
+				int32 Width = 0;
+				int32 Height = 0;
+				TArray<FColor> Pixels;
+			};
+
+			// modules can only be loaded on the game thread
+			IImageWrapperModule* ImageWrapperModule = FModuleManager::LoadModulePtr<IImageWrapperModule>("ImageWrapper");
+			TSharedRef<FResult, ESPMode::ThreadSafe> Result = MakeShared<FResult, ESPMode::ThreadSafe>();
+			TArray<uint8> Bytes = BytesSubArray(ByteArray, Index, Length);
+			int32* OutputWidth = &Width;
+			int32* OutputHeight = &Height;
+			TArray<FColor>* OutputPixels = &Pixels;
+
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryImageAction([ImageWrapperModule, Result, Bytes = MoveTemp(Bytes), ImageFormat]()
+			{
+				int32 DataWidth = 0;
+				int32 DataHeight = 0;
+				TArray<uint8> Uncompressed;
+				if ((ImageWrapperModule == nullptr) || (Bytes.Num() <= 0) || !DecodeImage(*ImageWrapperModule, Bytes.GetData(), Bytes.Num(), ImageFormat, DataWidth, DataHeight, Uncompressed))
+				{
+					return;
+				}
+				Result->Pixels = BGRAToPixels(DataWidth, DataHeight, Uncompressed);
+				if (Result->Pixels.Num() > 0)
+				{
+					Result->Width = DataWidth;
+					Result->Height = DataHeight;
+				}
+			}, [Result, OutputWidth, OutputHeight, OutputPixels]()
+			{
+				*OutputWidth = Result->Width;
+				*OutputHeight = Result->Height;
+				*OutputPixels = MoveTemp(Result->Pixels);
+			}, LatentInfo));
+		}
+	}
+}
+
+void ULowEntryExtendedStandardLibrary::PixelsToBytesAsync(UObject* WorldContextObject, const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality)
+{
+	ByteArray = TArray<uint8>();
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryImageAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			// modules can only be loaded on the game thread
+			IImageWrapperModule* ImageWrapperModule = FModuleManager::LoadModulePtr<IImageWrapperModule>("ImageWrapper");
+			TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Result = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+			TArray<uint8>* Output = &ByteArray;
+
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryImageAction([ImageWrapperModule, Result, Width, Height, Pixels, ImageFormat, CompressionQuality]()
+			{
+				if (ImageWrapperModule != nullptr)
+				{
+					*Result = EncodePixels(*ImageWrapperModule, Width, Height, Pixels, ImageFormat, CompressionQuality);
+				}
+			}, [Result, Output]()
+			{
+				*Output = MoveTemp(*Result);
+			}, LatentInfo));
+		}
+	}
+}
+
+
+ULowEntryTexturePool* ULowEntryExtendedStandardLibrary::TexturePool_Create(const int32 MaxTexturesPerSize)
+{
+	return ULowEntryTexturePool::Create(MaxTexturesPerSize);
 }
 
 
@@ -1720,114 +1769,70 @@ FColor ULowEntryExtendedStandardLibrary::GrayscalePixel(const FColor& Pixel)
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::GrayscalePixels(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(GrayscalePixel(Pixel));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::Grayscale).Apply(Pixels);
 }
 
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsRG(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.G, Pixel.R, Pixel.B, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipRedGreen).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsGB(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.B, Pixel.G, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipGreenBlue).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsRB(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.B, Pixel.G, Pixel.R, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipRedBlue).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsRA(const TArray<FColor>& Pixels)
-{
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.A, Pixel.G, Pixel.B, Pixel.R));
-	}
-	return Result;
+{
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipRedAlpha).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsGA(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.A, Pixel.B, Pixel.G));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipGreenAlpha).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::FlipPixelChannelsBA(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.G, Pixel.A, Pixel.B));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::FlipBlueAlpha).Apply(Pixels);
 }
 
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::InvertPixelChannelR(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R ^ 0xff, Pixel.G, Pixel.B, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::InvertRed).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::InvertPixelChannelG(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.G ^ 0xff, Pixel.B, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::InvertGreen).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::InvertPixelChannelB(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.G, Pixel.B ^ 0xff, Pixel.A));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::InvertBlue).Apply(Pixels);
 }
 
 TArray<FColor> ULowEntryExtendedStandardLibrary::InvertPixelChannelA(const TArray<FColor>& Pixels)
 {
-	TArray<FColor> Result;
-	for (const FColor& Pixel : Pixels)
-	{
-		Result.Add(FColor(Pixel.R, Pixel.G, Pixel.B, Pixel.A ^ 0xff));
-	}
-	return Result;
+	return FLowEntryPixelOpChain(ELowEntryPixelOp::InvertAlpha).Apply(Pixels);
+}
+
+
+TArray<FColor> ULowEntryExtendedStandardLibrary::ApplyPixelOps(const TArray<FColor>& Pixels, const TArray<ELowEntryPixelOp>& Ops)
+{
+	return FLowEntryPixelOpChain(Ops).Apply(Pixels);
+}
+
+void ULowEntryExtendedStandardLibrary::ApplyPixelOpsInPlace(TArray<FColor>& Pixels, const TArray<ELowEntryPixelOp>& Ops)
+{
+	FLowEntryPixelOpChain(Ops).ApplyInPlace(Pixels);
 }
 
 
@@ -1995,6 +2000,29 @@ UTexture2D* ULowEntryExtendedStandardLibrary::DataToExistingTexture2D(UTexture2D
 	return Texture2D;
 }
 
+UTexture2D* ULowEntryExtendedStandardLibrary::DataToExistingTexture2DStreamed(UTexture2D* Texture2D, int32 Width, int32 Height, TArray<uint8>&& Data)
+{
+	if ((Texture2D == nullptr) || (Texture2D->GetSizeX() != Width) || (Texture2D->GetSizeY() != Height) || (Texture2D->GetPixelFormat() != PF_B8G8R8A8) || (Texture2D->GetResource() == nullptr) || (Data.Num() != Width * Height * 4))
+	{
+		return DataToExistingTexture2D(Texture2D, Width, Height, Data.GetData(), Data.Num());
+	}
+
+	// the CPU copy is kept up to date as well, since Texture2DToPixels reads from it
+	void* TextureData = Texture2D->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(TextureData, Data.GetData(), Data.Num());
+	Texture2D->GetPlatformData()->Mips[0].BulkData.Unlock();
+
+	// the pixels of the existing resource are updated on the render thread, the data has to stay alive until then
+	FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
+	TArray<uint8>* RegionData = new TArray<uint8>(MoveTemp(Data));
+	Texture2D->UpdateTextureRegions(0, 1, Region, Width * 4, 4, RegionData->GetData(), [RegionData](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+	{
+		delete RegionData;
+		delete Regions;
+	});
+	return Texture2D;
+}
+
 
 void ULowEntryExtendedStandardLibrary::SceneCapture2DToBytes(ASceneCapture2D* SceneCapture2D, const ELowEntryImageFormat ImageFormat, TArray<uint8>& ByteArray, const int32 CompressionQuality)
 {
@@ -2109,6 +2137,104 @@ void ULowEntryExtendedStandardLibrary::TextureRenderTarget2DToPixels(UTextureRen
 }
 
 
+void ULowEntryExtendedStandardLibrary::SceneCapture2DToBytesAsync(UObject* WorldContextObject, ASceneCapture2D* SceneCapture2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality)
+{
+	SceneCaptureComponent2DToBytesAsync(WorldContextObject, (SceneCapture2D != nullptr) ? SceneCapture2D->GetCaptureComponent2D() : nullptr, ImageFormat, LatentInfo, ByteArray, CompressionQuality);
+}
+
+void ULowEntryExtendedStandardLibrary::SceneCaptureComponent2DToBytesAsync(UObject* WorldContextObject, USceneCaptureComponent2D* SceneCaptureComponent2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality)
+{
+	TextureRenderTarget2DToBytesAsync(WorldContextObject, (SceneCaptureComponent2D != nullptr) ? SceneCaptureComponent2D->TextureTarget.Get() : nullptr, ImageFormat, LatentInfo, ByteArray, CompressionQuality);
+}
+
+void ULowEntryExtendedStandardLibrary::TextureRenderTarget2DToBytesAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality)
+{
+	ByteArray = TArray<uint8>();
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryRenderTargetReadbackAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			if ((TextureRenderTarget2D != nullptr) && (TextureRenderTarget2D->GetFormat() != PF_B8G8R8A8))
+			{
+				UE_LOG(LogBlueprintUserMessages, Error, TEXT("in ImageToBytes, the TextureRenderTarget2D has a [Render Target Format] that is not supported, use [RTF RGBA8] instead ([PF_B8G8R8A8] in C++)"));
+				TextureRenderTarget2D = nullptr;
+			}
+
+			// modules can only be loaded on the game thread
+			IImageWrapperModule* ImageWrapperModule = FModuleManager::LoadModulePtr<IImageWrapperModule>("ImageWrapper");
+			TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Result = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+			TArray<uint8>* Output = &ByteArray;
+
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryRenderTargetReadbackAction(TextureRenderTarget2D, [ImageWrapperModule, Result, ImageFormat, CompressionQuality](const int32 Width, const int32 Height, TArray<FColor>&& Pixels)
+			{
+				if (ImageWrapperModule != nullptr)
+				{
+					*Result = EncodePixels(*ImageWrapperModule, Width, Height, Pixels, ImageFormat, CompressionQuality);
+				}
+			}, [Result, Output]()
+			{
+				*Output = MoveTemp(*Result);
+			}, LatentInfo));
+		}
+	}
+}
+
+
+void ULowEntryExtendedStandardLibrary::SceneCapture2DToPixelsAsync(UObject* WorldContextObject, ASceneCapture2D* SceneCapture2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels)
+{
+	SceneCaptureComponent2DToPixelsAsync(WorldContextObject, (SceneCapture2D != nullptr) ? SceneCapture2D->GetCaptureComponent2D() : nullptr, LatentInfo, Width, Height, Pixels);
+}
+
+void ULowEntryExtendedStandardLibrary::SceneCaptureComponent2DToPixelsAsync(UObject* WorldContextObject, USceneCaptureComponent2D* SceneCaptureComponent2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels)
+{
+	TextureRenderTarget2DToPixelsAsync(WorldContextObject, (SceneCaptureComponent2D != nullptr) ? SceneCaptureComponent2D->TextureTarget.Get() : nullptr, LatentInfo, Width, Height, Pixels);
+}
+
+void ULowEntryExtendedStandardLibrary::TextureRenderTarget2DToPixelsAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels)
+{
+	Width = 0;
+	Height = 0;
+	Pixels = TArray<FColor>();
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryRenderTargetReadbackAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			if ((TextureRenderTarget2D != nullptr) && (TextureRenderTarget2D->GetFormat() != PF_B8G8R8A8))
+			{
+				UE_LOG(LogBlueprintUserMessages, Error, TEXT("in ImageToPixels, the TextureRenderTarget2D has a [Render Target Format] that is not supported, use [RTF RGBA8] instead ([PF_B8G8R8A8] in C++)"));
+				TextureRenderTarget2D = nullptr;
+			}
+
+			struct FResult
+			{
+				int32 Width = 0;
+				int32 Height = 0;
+				TArray<FColor> Pixels;
+			};
+
+			TSharedRef<FResult, ESPMode::ThreadSafe> Result = MakeShared<FResult, ESPMode::ThreadSafe>();
+			int32* OutputWidth = &Width;
+			int32* OutputHeight = &Height;
+			TArray<FColor>* OutputPixels = &Pixels;
+
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryRenderTargetReadbackAction(TextureRenderTarget2D, [Result](const int32 DataWidth, const int32 DataHeight, TArray<FColor>&& DataPixels)
+			{
+				Result->Width = DataWidth;
+				Result->Height = DataHeight;
+				Result->Pixels = MoveTemp(DataPixels);
+			}, [Result, OutputWidth, OutputHeight, OutputPixels]()
+			{
+				*OutputWidth = Result->Width;
+				*OutputHeight = Result->Height;
+				*OutputPixels = MoveTemp(Result->Pixels);
+			}, LatentInfo));
+		}
+	}
+}
+
+
 void ULowEntryExtendedStandardLibrary::LoadVideo(UMediaSoundComponent* MediaSoundComponent, const FString& Url, bool& Success, UMediaPlayer*& Player, UMediaTexture*& Texture, const bool PlayOnOpen, const bool Loop)
 {
 	Success = false;
@@ -2237,11 +2363,74 @@ TArray<uint8> ULowEntryExtendedStandardLibrary::Sha512(const TArray<uint8>& Byte
 	return ULowEntryHashingSha512Library::Hash(ByteArray, Index, Length);
 }
 
+void ULowEntryExtendedStandardLibrary::Sha256File(const FString& FilePath, TArray<uint8>& Hash, bool& Success)
+{
+	Success = ULowEntryHashingSha256Library::HashFile(FilePath, Hash);
+}
+
+void ULowEntryExtendedStandardLibrary::Sha512File(const FString& FilePath, TArray<uint8>& Hash, bool& Success)
+{
+	Success = ULowEntryHashingSha512Library::HashFile(FilePath, Hash);
+}
+
+ULowEntrySha256Hasher* ULowEntryExtendedStandardLibrary::Sha256Hasher_Create()
+{
+	return ULowEntrySha256Hasher::Create();
+}
+
+ULowEntrySha512Hasher* ULowEntryExtendedStandardLibrary::Sha512Hasher_Create()
+{
+	return ULowEntrySha512Hasher::Create();
+}
+
 TArray<uint8> ULowEntryExtendedStandardLibrary::BCrypt(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength, int32 Index, int32 Length)
 {
 	return ULowEntryHashingBCryptLibrary::Hash(BytesSubArray(ByteArray, Index, Length), Salt, Strength);
 }
 
+void ULowEntryExtendedStandardLibrary::BCryptAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, FLatentActionInfo LatentInfo, TArray<uint8>& Hash, int32 Strength, int32 Index, int32 Length)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryBCryptAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryBCryptAction(TArray<TArray<uint8>>{BytesSubArray(ByteArray, Index, Length)}, TArray<TArray<uint8>>{Salt}, Strength, nullptr, &Hash, LatentInfo));
+		}
+	}
+}
+
+void ULowEntryExtendedStandardLibrary::BCryptArrayAsync(UObject* WorldContextObject, const TArray<ULowEntryByteArray*>& ByteArrays, const TArray<ULowEntryByteArray*>& Salts, FLatentActionInfo LatentInfo, TArray<ULowEntryByteArray*>& Hashes, int32 Strength)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryBCryptAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			// the bytes are copied out of the UObjects here, the worker threads shouldn't touch any UObjects
+			TArray<TArray<uint8>> Bytes;
+			Bytes.SetNum(ByteArrays.Num());
+			for (int32 i = 0; i < ByteArrays.Num(); i++)
+			{
+				if (ByteArrays[i] != nullptr)
+				{
+					Bytes[i] = ByteArrays[i]->ByteArray;
+				}
+			}
+			TArray<TArray<uint8>> SaltBytes;
+			SaltBytes.SetNum(Salts.Num());
+			for (int32 i = 0; i < Salts.Num(); i++)
+			{
+				if (Salts[i] != nullptr)
+				{
+					SaltBytes[i] = Salts[i]->ByteArray;
+				}
+			}
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryBCryptAction(Bytes, SaltBytes, Strength, &Hashes, nullptr, LatentInfo));
+		}
+	}
+}
+
 
 TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC(const TArray<uint8>& ByteArray, const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm, int32 Index, int32 Length)
 {
@@ -2255,69 +2444,28 @@ TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC(const TArray<uint8>& ByteAr
 		Length = ByteArray.Num() - Index;
 	}
 
-	int32 BlockSize = HMAC_GetBlockSize(Algorithm);
-
-	TArray<uint8> KeyBytes = Key;
-	if (KeyBytes.Num() > BlockSize)
-	{
-		KeyBytes = HMAC_Hash(KeyBytes, Algorithm);// key = hash(key)
-	}
-	if (KeyBytes.Num() != BlockSize)
-	{
-		KeyBytes.SetNumZeroed(BlockSize);// key = key + 0x00 (till KeyBytes has BlockSize length)
-	}
-
-	TArray<uint8> ArrayO = KeyBytes;
-	TArray<uint8> ArrayI = KeyBytes;
-	for (int32 i = 0; i < KeyBytes.Num(); i++)
-	{
-		ArrayO[i] ^= 0x5c;// o_key_pad = 0x5c ^ key
-		ArrayI[i] ^= 0x36;// i_key_pad = 0x36 ^ key
-	}
-
-	if (Length > 0)// (i_key_pad + message)
-	{
-		ArrayI.Append(ByteArray.GetData() + Index, Length);
-	}
-	ArrayI = HMAC_Hash(ArrayI, Algorithm);// hash(i_key_pad + message)
-	ArrayO.Append(ArrayI.GetData(), ArrayI.Num());// (o_key_pad + hash(i_key_pad + message))
-	return HMAC_Hash(ArrayO, Algorithm);// hash(o_key_pad + hash(i_key_pad + message))
+	ULowEntryHashingHmacLibrary Hasher(Key.GetData(), Key.Num(), HMAC_ValidateAlgorithm(Algorithm));
+	return Hasher.Sign(ByteArray.GetData() + Index, Length);
 }
 
-int32 ULowEntryExtendedStandardLibrary::HMAC_GetBlockSize(ELowEntryHmacAlgorithm Algorithm)
+ELowEntryHmacAlgorithm ULowEntryExtendedStandardLibrary::HMAC_ValidateAlgorithm(ELowEntryHmacAlgorithm Algorithm)
 {
 	switch (Algorithm)
 	{
 	case ELowEntryHmacAlgorithm::MD5:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA1:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA256:
-		return 64;
 	case ELowEntryHmacAlgorithm::SHA512:
-		return 128;
+		return Algorithm;
 	default:
 		UE_LOG(LogBlueprintUserMessages, Error, TEXT("Unsupported HMAC Algorithm, falls back to SHA-256"));
-		return 64;// defaults to SHA-256
+		return ELowEntryHmacAlgorithm::SHA256;// defaults to SHA-256
 	}
 }
 
-TArray<uint8> ULowEntryExtendedStandardLibrary::HMAC_Hash(const TArray<uint8>& Array, ELowEntryHmacAlgorithm Algorithm)
+ULowEntryHmacContext* ULowEntryExtendedStandardLibrary::HmacContext_Create(const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm)
 {
-	switch (Algorithm)
-	{
-	case ELowEntryHmacAlgorithm::MD5:
-		return Md5(Array);
-	case ELowEntryHmacAlgorithm::SHA1:
-		return Sha1(Array);
-	case ELowEntryHmacAlgorithm::SHA256:
-		return Sha256(Array);
-	case ELowEntryHmacAlgorithm::SHA512:
-		return Sha512(Array);
-	default:
-		UE_LOG(LogBlueprintUserMessages, Error, TEXT("Unsupported HMAC Algorithm, falls back to SHA-256"));
-		return Sha256(Array);// defaults to SHA-256
-	}
+	return ULowEntryHmacContext::Create(Key, HMAC_ValidateAlgorithm(Algorithm));
 }
 
 
@@ -2342,6 +2490,41 @@ FString ULowEntryExtendedStandardLibrary::HashcashCustomCreationDate(const FStri
 }
 
 
+void ULowEntryExtendedStandardLibrary::HashcashArrayAsync(UObject* WorldContextObject, const TArray<FString>& Resources, const int32 Bits, FLatentActionInfo LatentInfo, TArray<FString>& Hashes)
+{
+	HashcashArrayCustomCreationDateAsync(WorldContextObject, Resources, FDateTime::UtcNow(), Bits, LatentInfo, Hashes);
+}
+
+void ULowEntryExtendedStandardLibrary::HashcashArrayCustomCreationDateAsync(UObject* WorldContextObject, const TArray<FString>& Resources, const FDateTime& UtcDate, const int32 Bits, FLatentActionInfo LatentInfo, TArray<FString>& Hashes)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryHashcashAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryHashcashAction(Resources, UtcDate, Bits, &Hashes, nullptr, LatentInfo));
+		}
+	}
+}
+
+void ULowEntryExtendedStandardLibrary::HashcashAsync(UObject* WorldContextObject, const FString& Resource, const int32 Bits, FLatentActionInfo LatentInfo, FString& Hash)
+{
+	HashcashCustomCreationDateAsync(WorldContextObject, Resource, FDateTime::UtcNow(), Bits, LatentInfo, Hash);
+}
+
+void ULowEntryExtendedStandardLibrary::HashcashCustomCreationDateAsync(UObject* WorldContextObject, const FString& Resource, const FDateTime& UtcDate, const int32 Bits, FLatentActionInfo LatentInfo, FString& Hash)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		if (LatentActionManager.FindExistingAction<FLowEntryHashcashAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) == nullptr)
+		{
+			LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLowEntryHashcashAction(TArray<FString>{Resource}, UtcDate, Bits, nullptr, &Hash, LatentInfo));
+		}
+	}
+}
+
+
 TArray<ULowEntryParsedHashcash*> ULowEntryExtendedStandardLibrary::HashcashParseArray(const TArray<FString>& Hashes)
 {
 	return ULowEntryHashingHashcashLibrary::parseArray(Hashes);
@@ -2353,6 +2536,12 @@ ULowEntryParsedHashcash* ULowEntryExtendedStandardLibrary::HashcashParse(const F
 }
 
 
+ULowEntryHashcashSpentCache* ULowEntryExtendedStandardLibrary::HashcashSpentCache_Create(const int32 MaxEntries, const int32 MaxAgeSeconds, const int32 MaxFutureSeconds)
+{
+	return ULowEntryHashcashSpentCache::Create(MaxEntries, MaxAgeSeconds, MaxFutureSeconds);
+}
+
+
 bool ULowEntryExtendedStandardLibrary::ParsedHashcashIsValid(ULowEntryParsedHashcash* Target)
 {
 	if (Target == nullptr)
@@ -3085,6 +3274,60 @@ void ULowEntryExtendedStandardLibrary::SortStructArrayDirectly(UPARAM(ref) TArra
 }
 
 
+TArray<UObject*> ULowEntryExtendedStandardLibrary::SortObjectArrayByKey(const TArray<UObject*>& ObjectArray, FDelegateULowEntryExtendedStandardLibraryObjectSortKey KeyFunction, const bool Reversed)
+{
+	TArray<UObject*> Array = ObjectArray;
+	SortObjectArrayByKeyDirectly(Array, KeyFunction, Reversed);
+	return Array;
+}
+
+void ULowEntryExtendedStandardLibrary::SortObjectArrayByKeyDirectly(UPARAM(ref) TArray<UObject*>& ObjectArray, FDelegateULowEntryExtendedStandardLibraryObjectSortKey KeyFunction, const bool Reversed)
+{
+	if (!KeyFunction.IsBound())
+	{
+		return;
+	}
+
+	// the Blueprint function is called once per object, the sorting itself is done natively
+	TArray<double> Keys;
+	Keys.SetNumUninitialized(ObjectArray.Num());
+	for (int32 i = 0; i < ObjectArray.Num(); i++)
+	{
+		double Key = 0;
+		KeyFunction.Execute(ObjectArray[i], Key);
+		Keys[i] = Key;
+	}
+	ULowEntrySortLibrary::SortByKeys(ObjectArray, Keys, Reversed);
+}
+
+
+TArray<FInstancedStruct> ULowEntryExtendedStandardLibrary::SortStructArrayByKey(const TArray<FInstancedStruct>& StructArray, FDelegateULowEntryExtendedStandardLibraryStructSortKey KeyFunction, const bool Reversed)
+{
+	TArray<FInstancedStruct> Array = StructArray;
+	SortStructArrayByKeyDirectly(Array, KeyFunction, Reversed);
+	return Array;
+}
+
+void ULowEntryExtendedStandardLibrary::SortStructArrayByKeyDirectly(UPARAM(ref) TArray<FInstancedStruct>& StructArray, FDelegateULowEntryExtendedStandardLibraryStructSortKey KeyFunction, const bool Reversed)
+{
+	if (!KeyFunction.IsBound())
+	{
+		return;
+	}
+
+	// the Blueprint function is called once per struct, the sorting itself is done natively
+	TArray<double> Keys;
+	Keys.SetNumUninitialized(StructArray.Num());
+	for (int32 i = 0; i < StructArray.Num(); i++)
+	{
+		double Key = 0;
+		KeyFunction.Execute(StructArray[i], Key);
+		Keys[i] = Key;
+	}
+	ULowEntrySortLibrary::SortByKeys(StructArray, Keys, Reversed);
+}
+
+
 void ULowEntryExtendedStandardLibrary::RandomDelay(UObject* WorldContextObject, double MinDuration, double MaxDuration, FLatentActionInfo LatentInfo)
 {
 	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
@@ -3331,105 +3574,42 @@ FString ULowEntryExtendedStandardLibrary::ReplaceCharactersExcept(const FString&
 
 bool ULowEntryExtendedStandardLibrary::RegexMatch(const FString& String, const FString& Pattern)
 {
-	FRegexPattern RegexPattern(Pattern);
-	FRegexMatcher RegexMatcher(RegexPattern, String);
-	return RegexMatcher.FindNext();
+	return ULowEntryRegexLibrary::Match(ULowEntryRegexLibrary::GetCachedPattern(Pattern), String);
 }
 
 int32 ULowEntryExtendedStandardLibrary::RegexCount(const FString& String, const FString& Pattern)
 {
-	FRegexPattern RegexPattern(Pattern);
-	FRegexMatcher RegexMatcher(RegexPattern, String);
-	int32 Count = 0;
-	int32 Length = String.Len();
-	while (RegexMatcher.FindNext())
-	{
-		Count++;
-		int32 e = RegexMatcher.GetMatchEnding();
-		RegexMatcher.SetLimits(e, Length);
-	}
-	return Count;
+	return ULowEntryRegexLibrary::Count(ULowEntryRegexLibrary::GetCachedPattern(Pattern), String);
 }
 
 TArray<FLowEntryRegexMatch> ULowEntryExtendedStandardLibrary::RegexGetMatches(const FString& String, const FString& Pattern)
 {
-	TArray<FLowEntryRegexMatch> Matches;
-
-	int32 Length = String.Len();
-	FRegexPattern RegexPattern(Pattern);
-	FRegexMatcher RegexMatcher(RegexPattern, String);
-	int32 MatchNumber = 0;
-	while (RegexMatcher.FindNext())
-	{
-		MatchNumber++;
-		int32 b = RegexMatcher.GetMatchBeginning();
-		int32 e = RegexMatcher.GetMatchEnding();
-		if ((b < 0) || (e < 0))
-		{
-			continue;
-		}
-
-		TArray<FLowEntryRegexCaptureGroup> CaptureGroups;
-		int32 CaptureGroupNumber = 0;
-		while (true)
-		{
-			CaptureGroupNumber++;
-			int32 gb = RegexMatcher.GetCaptureGroupBeginning(CaptureGroupNumber);
-			int32 ge = RegexMatcher.GetCaptureGroupEnding(CaptureGroupNumber);
-			if ((gb < 0) || (ge < 0))
-			{
-				break;
-			}
-			FLowEntryRegexCaptureGroup GroupMatch;
-			GroupMatch.CaptureGroupNumber = CaptureGroupNumber;
-			GroupMatch.BeginIndex = gb;
-			GroupMatch.EndIndex = ge;
-			GroupMatch.Match = String.Mid(gb, ge - gb);
-			CaptureGroups.Add(GroupMatch);
-		}
-
-		FLowEntryRegexMatch Match;
-		Match.MatchNumber = MatchNumber;
-		Match.BeginIndex = b;
-		Match.EndIndex = e;
-		Match.Match = String.Mid(b, e - b);
-		Match.CaptureGroups = CaptureGroups;
-		Matches.Add(Match);
-
-		RegexMatcher.SetLimits(e, Length);
-	}
+	return ULowEntryRegexLibrary::GetMatches(ULowEntryRegexLibrary::GetCachedPattern(Pattern), String, true);
+}
 
-	return Matches;
+TArray<FLowEntryRegexMatch> ULowEntryExtendedStandardLibrary::RegexGetMatchOffsets(const FString& String, const FString& Pattern)
+{
+	return ULowEntryRegexLibrary::GetMatches(ULowEntryRegexLibrary::GetCachedPattern(Pattern), String, false);
 }
 
 FString ULowEntryExtendedStandardLibrary::RegexReplace(const FString& String, const FString& Pattern, const FString& Replacement)
 {
-	int32 Length = String.Len();
-
-	FString Result = TEXT("");
-	int32 LastMatchEnding = 0;
+	return ULowEntryRegexLibrary::Replace(ULowEntryRegexLibrary::GetCachedPattern(Pattern), String, Replacement);
+}
 
-	FRegexPattern RegexPattern(Pattern);
-	FRegexMatcher RegexMatcher(RegexPattern, String);
-	while (RegexMatcher.FindNext())
-	{
-		int32 b = RegexMatcher.GetMatchBeginning();
-		int32 e = RegexMatcher.GetMatchEnding();
+FString ULowEntryExtendedStandardLibrary::RegexMatchToString(const FString& String, const FLowEntryRegexMatch& Match)
+{
+	return String.Mid(Match.BeginIndex, Match.EndIndex - Match.BeginIndex);
+}
 
-		for (int32 i = LastMatchEnding; i < b; i++)
-		{
-			Result += String[i];
-		}
-		Result += Replacement;
+FString ULowEntryExtendedStandardLibrary::RegexCaptureGroupToString(const FString& String, const FLowEntryRegexCaptureGroup& CaptureGroup)
+{
+	return String.Mid(CaptureGroup.BeginIndex, CaptureGroup.EndIndex - CaptureGroup.BeginIndex);
+}
 
-		RegexMatcher.SetLimits(e, Length);
-		LastMatchEnding = e;
-	}
-	for (int32 i = LastMatchEnding; i < Length; i++)
-	{
-		Result += String[i];
-	}
-	return Result;
+ULowEntryRegex* ULowEntryExtendedStandardLibrary::Regex_Create(const FString& Pattern)
+{
+	return ULowEntryRegex::Create(Pattern);
 }
 
 
@@ -3508,6 +3688,27 @@ ULowEntryByteDataReader* ULowEntryExtendedStandardLibrary::ByteDataReader_Create
 	return ULowEntryByteDataReader::Create(Bytes, Index, Length);
 }
 
+ULowEntryByteDataReader* ULowEntryExtendedStandardLibrary::ByteDataReader_CreateFromCompressed(const TArray<uint8>& Bytes, bool& Success)
+{
+	ULowEntryByteDataReader* Reader = ULowEntryByteDataReader::CreateFromCompressed(Bytes);
+	Success = (Reader != nullptr);
+	return Reader;
+}
+
+ULowEntryByteDataStreamReader* ULowEntryExtendedStandardLibrary::ByteDataStreamReader_OpenFile(const FString& FilePath, bool& Success)
+{
+	ULowEntryByteDataStreamReader* Reader = ULowEntryByteDataStreamReader::OpenFile(FilePath);
+	Success = (Reader != nullptr);
+	return Reader;
+}
+
+ULowEntryByteDataStreamReader* ULowEntryExtendedStandardLibrary::ByteDataStreamReader_OpenCompressedFile(const FString& FilePath, bool& Success)
+{
+	ULowEntryByteDataStreamReader* Reader = ULowEntryByteDataStreamReader::OpenCompressedFile(FilePath);
+	Success = (Reader != nullptr);
+	return Reader;
+}
+
 
 ULowEntryByteDataWriter* ULowEntryExtendedStandardLibrary::ByteDataWriter_Create()
 {
@@ -3524,6 +3725,25 @@ ULowEntryByteDataWriter* ULowEntryExtendedStandardLibrary::ByteDataWriter_Create
 	return ULowEntryByteDataWriter::CreateFromEntryArray(Array);
 }
 
+ULowEntryByteDataWriter* ULowEntryExtendedStandardLibrary::ByteDataWriter_OpenFile(const FString& FilePath, const bool Append, bool& Success)
+{
+	ULowEntryByteDataWriter* Writer = ULowEntryByteDataWriter::OpenFile(FilePath, Append);
+	Success = (Writer != nullptr);
+	return Writer;
+}
+
+ULowEntryByteDataWriter* ULowEntryExtendedStandardLibrary::ByteDataWriter_OpenCompressedFile(const FString& FilePath, const bool Append, bool& Success)
+{
+	ULowEntryByteDataWriter* Writer = ULowEntryByteDataWriter::OpenCompressedFile(FilePath, Append);
+	Success = (Writer != nullptr);
+	return Writer;
+}
+
+ULowEntryByteDataSchema* ULowEntryExtendedStandardLibrary::ByteDataSchema_Create(const TArray<ULowEntryByteDataEntry*>& Layout)
+{
+	return ULowEntryByteDataSchema::Create(Layout);
+}
+
 TArray<uint8> ULowEntryExtendedStandardLibrary::ByteDataWriter_GetBytes(ULowEntryByteDataWriter* ByteDataWriter)
 {
 	return ByteDataWriter->GetBytes();
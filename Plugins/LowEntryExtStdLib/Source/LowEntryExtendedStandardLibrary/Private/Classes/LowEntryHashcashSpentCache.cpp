@@ -0,0 +1,139 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashcashSpentCache.h"
+
+#include "Misc/ScopeLock.h"
+
+
+namespace
+{
+	struct FLowEntryHashcashSpentEntryPredicate
+	{
+		template<typename T>
+		FORCEINLINE bool operator()(const T& A, const T& B) const
+		{
+			return (A.Date < B.Date);
+		}
+	};
+}
+
+
+ULowEntryHashcashSpentCache::ULowEntryHashcashSpentCache(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryHashcashSpentCache* ULowEntryHashcashSpentCache::Create(const int32 MaxEntries, const int32 MaxAgeSeconds, const int32 MaxFutureSeconds)
+{
+	ULowEntryHashcashSpentCache* Instance = NewObject<ULowEntryHashcashSpentCache>();
+	Instance->MaxEntries = FMath::Max(1, MaxEntries);
+	Instance->MaxAge = FTimespan::FromSeconds(FMath::Max(0, MaxAgeSeconds));
+	Instance->MaxFuture = FTimespan::FromSeconds(FMath::Max(0, MaxFutureSeconds));
+	return Instance;
+}
+
+
+bool ULowEntryHashcashSpentCache::Spend(const FLowEntryHashcashData& Data, const FDateTime& UtcNow)
+{
+	if (!Data.Valid)
+	{
+		return false;
+	}
+	if ((Data.Date < (UtcNow - MaxAge)) || (Data.Date > (UtcNow + MaxFuture)))
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	RemoveExpired(UtcNow);
+	if (Data.Date <= OldestAccepted)
+	{
+		return false;
+	}
+	if (Spent.Contains(Data.Hash))
+	{
+		return false;
+	}
+
+	if (Entries.Num() >= MaxEntries)
+	{
+		if (Data.Date <= Entries.HeapTop().Date)
+		{
+			// full, and not newer than anything that's remembered, so it would have to be forgotten right away
+			return false;
+		}
+		while (Entries.Num() >= MaxEntries)
+		{
+			RemoveOldest();
+		}
+	}
+
+	Spent.Add(Data.Hash);
+	Entries.HeapPush({Data.Date, Data.Hash}, FLowEntryHashcashSpentEntryPredicate());
+	return true;
+}
+
+
+bool ULowEntryHashcashSpentCache::Verify(const FString& Hash, const FString& Resource, const int32 MinBits)
+{
+	FLowEntryHashcashData Data = ULowEntryHashingHashcashLibrary::parseData(Hash);
+	if ((Data.Bits < MinBits) || !Data.Resource.Equals(Resource))
+	{
+		return false;
+	}
+	return Spend(Data, FDateTime::UtcNow());
+}
+
+TArray<bool> ULowEntryHashcashSpentCache::VerifyArray(const TArray<FString>& Hashes, const FString& Resource, const int32 MinBits)
+{
+	// parsing and hashing is the expensive part, that's done on all worker threads, the cache is only updated afterwards so that duplicates within the array are handled in order
+	TArray<FLowEntryHashcashData> Data = ULowEntryHashingHashcashLibrary::parseDataArray(Hashes);
+	const FDateTime UtcNow = FDateTime::UtcNow();
+
+	TArray<bool> Result;
+	Result.SetNumZeroed(Data.Num());
+	for (int32 i = 0; i < Data.Num(); i++)
+	{
+		if ((Data[i].Bits >= MinBits) && Data[i].Resource.Equals(Resource))
+		{
+			Result[i] = Spend(Data[i], UtcNow);
+		}
+	}
+	return Result;
+}
+
+
+int32 ULowEntryHashcashSpentCache::GetCount()
+{
+	FScopeLock ScopeLock(&Lock);
+	return Entries.Num();
+}
+
+void ULowEntryHashcashSpentCache::Clear()
+{
+	FScopeLock ScopeLock(&Lock);
+	Spent.Empty();
+	Entries.Empty();
+	OldestAccepted = FDateTime(0);
+}
+
+
+void ULowEntryHashcashSpentCache::RemoveExpired(const FDateTime& UtcNow)
+{
+	const FDateTime Expired = UtcNow - MaxAge;
+	while ((Entries.Num() > 0) && (Entries.HeapTop().Date < Expired))
+	{
+		FSpentEntry Entry;
+		Entries.HeapPop(Entry, FLowEntryHashcashSpentEntryPredicate(), EAllowShrinking::No);
+		Spent.Remove(Entry.Hash);
+	}
+}
+
+void ULowEntryHashcashSpentCache::RemoveOldest()
+{
+	FSpentEntry Entry;
+	Entries.HeapPop(Entry, FLowEntryHashcashSpentEntryPredicate(), EAllowShrinking::No);
+	Spent.Remove(Entry.Hash);
+	if (Entry.Date > OldestAccepted)
+	{
+		OldestAccepted = Entry.Date;
+	}
+}
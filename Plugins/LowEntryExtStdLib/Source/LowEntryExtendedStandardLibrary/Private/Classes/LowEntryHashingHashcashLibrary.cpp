@@ -2,11 +2,22 @@
 
 #include "LowEntryHashingHashcashLibrary.h"
 #include "LowEntryExtendedStandardLibrary.h"
+#include "LowEntryRandomLibrary.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+
+#include <atomic>
 
 
 const FString ULowEntryHashingHashcashLibrary::DATE_FORMAT_STRING = TEXT("%y%m%d%H%M%S");
 
-TArray<TArray<uint8>> ULowEntryHashingHashcashLibrary::BASE_64_CACHE = TArray<TArray<uint8>>();
+const TArray<TArray<uint8>>& ULowEntryHashingHashcashLibrary::getBase64Cache()
+{
+	static const TArray<TArray<uint8>> Cache = GenerateBase64Cache();
+	return Cache;
+}
 
 
 TArray<TArray<uint8>> ULowEntryHashingHashcashLibrary::GenerateBase64Cache()
@@ -27,13 +38,7 @@ TArray<FString> ULowEntryHashingHashcashLibrary::hashArray(const TArray<FString>
 }
 TArray<FString> ULowEntryHashingHashcashLibrary::hashArrayCustomCreationDate(const TArray<FString>& resources, const FDateTime& date, const int32 bits)
 {
-	TArray<FString> result;
-	result.SetNum(resources.Num());
-	for (int64 i = 0; i < resources.Num(); i++)
-	{
-		result[i] = hashCustomCreationDate(resources[i], date, bits);
-	}
-	return result;
+	return hashArrayParallel(resources, date, bits, nullptr);
 }
 
 FString ULowEntryHashingHashcashLibrary::hash(const FString& resource, const int32 bits)
@@ -42,63 +47,196 @@ FString ULowEntryHashingHashcashLibrary::hash(const FString& resource, const int
 }
 FString ULowEntryHashingHashcashLibrary::hashCustomCreationDate(const FString& resource, const FDateTime& date, const int32 bits)
 {
-	FSHA1 hasher;
-	TArray<uint8> hashBuffer;
-	hashBuffer.SetNum(FSHA1::DigestSize);
+	return hashParallel(resource, date, bits, nullptr);
+}
 
-	FString dataPrefix = FString::FromInt(VERSION) + TEXT(":") + FString::FromInt(bits) + TEXT(":") + getDateString(date) + TEXT(":") + resource + TEXT("::");
-	TArray<uint8> dataPrefixBytes = ULowEntryExtendedStandardLibrary::StringToBytesUtf8(dataPrefix);
 
-	TArray<uint8> buffer;
-	buffer.Reserve(dataPrefixBytes.Num() + 17 + 8);
-	buffer.Append(dataPrefixBytes);
+TArray<FString> ULowEntryHashingHashcashLibrary::hashArrayParallel(const TArray<FString>& resources, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled)
+{
+	TArray<FString> result;
+	result.SetNum(resources.Num());
 
-	int32 prefixpos = buffer.Num();
+	if (resources.Num() >= getWorkerCount())
+	{
+		// enough resources to keep every worker busy, so mint one resource per worker
+		ParallelFor(resources.Num(), [&resources, &result, &date, bits, cancelled](const int32 i)
+		{
+			result[i] = hashSingleThreaded(resources[i], date, bits, cancelled);
+		});
+		return result;
+	}
 
-	while (true)
+	for (int64 i = 0; i < resources.Num(); i++)
 	{
-		buffer.SetNum(prefixpos, EAllowShrinking::No);
+		if ((cancelled != nullptr) && *cancelled)
+		{
+			break;
+		}
+		result[i] = hashParallel(resources[i], date, bits, cancelled);
+	}
+	return result;
+}
+
+FString ULowEntryHashingHashcashLibrary::hashParallel(const FString& resource, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled)
+{
+	const int32 workers = getWorkerCount();
+	if (workers <= 1)
+	{
+		return hashSingleThreaded(resource, date, bits, cancelled);
+	}
+
+	const TArray<TArray<uint8>>& base64Cache = getBase64Cache();
+	const TArray<uint8> dataPrefixBytes = getDataPrefixBytes(resource, date, bits);
 
-		TArray<uint8> randomBytes;
-		ULowEntryExtendedStandardLibrary::GenerateRandomBytes(12, randomBytes);
-		buffer.Append(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(ULowEntryExtendedStandardLibrary::BytesToBase64(randomBytes) + TEXT(":")));
+	while ((cancelled == nullptr) || !*cancelled)
+	{
+		const TArray<uint8> buffer = getRandomizedBuffer(dataPrefixBytes);
+
+		// every worker tries a different part of the counters, the first one that finds a valid counter stops the others
+		std::atomic<int32> found(-1);
+		ParallelFor(workers, [&base64Cache, &buffer, &found, bits, workers, cancelled](const int32 worker)
+		{
+			FSHA1 hasher;
+			uint8 hashBuffer[FSHA1::DigestSize];
+			int32 tried = 0;
+			for (int32 counter = worker; counter < base64Cache.Num(); counter += workers)
+			{
+				if ((++tried % CANCEL_CHECK_INTERVAL) == 0)
+				{
+					if ((found.load(std::memory_order_relaxed) >= 0) || ((cancelled != nullptr) && *cancelled))
+					{
+						return;
+					}
+				}
+
+				const TArray<uint8>& base64counter = base64Cache[counter];
+				hasher.Reset();
+				hasher.Update(buffer.GetData(), buffer.Num());
+				hasher.Update(base64counter.GetData(), base64counter.Num());
+				hasher.Final();
+				hasher.GetHash(hashBuffer);
+
+				if (countLeadingZeroBits(hashBuffer, FSHA1::DigestSize) >= bits)
+				{
+					int32 expected = -1;
+					found.compare_exchange_strong(expected, counter);
+					return;
+				}
+			}
+		});
 
-		if (BASE_64_CACHE.Num() <= 0)
+		const int32 counter = found.load();
+		if (counter >= 0)
 		{
-			BASE_64_CACHE = GenerateBase64Cache();
+			TArray<uint8> result = buffer;
+			result.Append(base64Cache[counter]);
+			return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(result);
 		}
-		for (const TArray<uint8>& base64counter : BASE_64_CACHE)
+	}
+	return TEXT("");
+}
+
+FString ULowEntryHashingHashcashLibrary::hashSingleThreaded(const FString& resource, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled)
+{
+	FSHA1 hasher;
+	uint8 hashBuffer[FSHA1::DigestSize];
+
+	const TArray<TArray<uint8>>& base64Cache = getBase64Cache();
+	const TArray<uint8> dataPrefixBytes = getDataPrefixBytes(resource, date, bits);
+
+	while ((cancelled == nullptr) || !*cancelled)
+	{
+		TArray<uint8> buffer = getRandomizedBuffer(dataPrefixBytes);
+
+		int32 tried = 0;
+		for (const TArray<uint8>& base64counter : base64Cache)
 		{
+			if ((++tried % CANCEL_CHECK_INTERVAL) == 0)
+			{
+				if ((cancelled != nullptr) && *cancelled)
+				{
+					return TEXT("");
+				}
+			}
+
 			hasher.Reset();
 			hasher.Update(buffer.GetData(), buffer.Num());
 			hasher.Update(base64counter.GetData(), base64counter.Num());
 			hasher.Final();
-			hasher.GetHash(hashBuffer.GetData());
+			hasher.GetHash(hashBuffer);
 
-			int32 leadingZeroBits = countLeadingZeroBits(hashBuffer);
-			if (leadingZeroBits >= bits)
+			if (countLeadingZeroBits(hashBuffer, FSHA1::DigestSize) >= bits)
 			{
 				buffer.Append(base64counter);
 				return ULowEntryExtendedStandardLibrary::BytesToStringUtf8(buffer);
 			}
 		}
 	}
+	return TEXT("");
+}
+
+TArray<uint8> ULowEntryHashingHashcashLibrary::getDataPrefixBytes(const FString& resource, const FDateTime& date, const int32 bits)
+{
+	FString dataPrefix = FString::FromInt(VERSION) + TEXT(":") + FString::FromInt(bits) + TEXT(":") + getDateString(date) + TEXT(":") + resource + TEXT("::");
+	return ULowEntryExtendedStandardLibrary::StringToBytesUtf8(dataPrefix);
+}
+
+TArray<uint8> ULowEntryHashingHashcashLibrary::getRandomizedBuffer(const TArray<uint8>& dataPrefixBytes)
+{
+	TArray<uint8> randomBytes = ULowEntryRandomLibrary::SecureRandomBytes(12);
+
+	TArray<uint8> buffer;
+	buffer.Reserve(dataPrefixBytes.Num() + 17 + 8);
+	buffer.Append(dataPrefixBytes);
+	buffer.Append(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(ULowEntryExtendedStandardLibrary::BytesToBase64(randomBytes) + TEXT(":")));
+	return buffer;
+}
+
+int32 ULowEntryHashingHashcashLibrary::getWorkerCount()
+{
+	if (!FApp::ShouldUseThreadingForPerformance())
+	{
+		return 1;
+	}
+	return FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
 }
 
 
 TArray<ULowEntryParsedHashcash*> ULowEntryHashingHashcashLibrary::parseArray(const TArray<FString>& Hashcashes)
 {
+	// the parsing and hashing is done on all worker threads, only the UObjects are created on this thread
+	TArray<FLowEntryHashcashData> data = parseDataArray(Hashcashes);
 	TArray<ULowEntryParsedHashcash*> result;
-	result.SetNum(Hashcashes.Num());
-	for (int64 i = 0; i < Hashcashes.Num(); i++)
+	result.SetNum(data.Num());
+	for (int64 i = 0; i < data.Num(); i++)
 	{
-		result[i] = parse(Hashcashes[i]);
+		result[i] = ULowEntryParsedHashcash::Create(data[i].Valid, data[i].Resource, data[i].Date, data[i].Bits);
 	}
 	return result;
 }
 
 ULowEntryParsedHashcash* ULowEntryHashingHashcashLibrary::parse(const FString& Hashcash)
 {
+	FLowEntryHashcashData data = parseData(Hashcash);
+	return ULowEntryParsedHashcash::Create(data.Valid, data.Resource, data.Date, data.Bits);
+}
+
+
+TArray<FLowEntryHashcashData> ULowEntryHashingHashcashLibrary::parseDataArray(const TArray<FString>& Hashcashes)
+{
+	TArray<FLowEntryHashcashData> result;
+	result.SetNum(Hashcashes.Num());
+	ParallelFor(Hashcashes.Num(), [&Hashcashes, &result](const int32 i)
+	{
+		result[i] = parseData(Hashcashes[i]);
+	}, (Hashcashes.Num() < PARALLEL_PARSE_MIN_COUNT));
+	return result;
+}
+
+FLowEntryHashcashData ULowEntryHashingHashcashLibrary::parseData(const FString& Hashcash)
+{
+	FLowEntryHashcashData result;
+
 	TArray<FString> parts;
 	Hashcash.ParseIntoArray(parts, TEXT(":"), false);
 	if (parts.Num() >= 6)
@@ -109,13 +247,19 @@ ULowEntryParsedHashcash* ULowEntryHashingHashcashLibrary::parse(const FString& H
 			FDateTime date = parseDateString(parts[1]);
 			if (date.GetYear() > 1)
 			{
-				int32 bits = countLeadingZeroBits(ULowEntryExtendedStandardLibrary::Sha1(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Hashcash)));
+				TArray<uint8> bytes = ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Hashcash);
+				FSHA1::HashBuffer(bytes.GetData(), bytes.Num(), result.Hash.Hash);
+				int32 bits = countLeadingZeroBits(result.Hash.Hash, FSHA1::DigestSize);
 				FString resource = parts[2];
 				for (int32 i = 3; i < (parts.Num() - 3); i++)
 				{
 					resource += TEXT(":") + parts[i];
 				}
-				return ULowEntryParsedHashcash::Create(true, resource, date, bits);
+				result.Valid = true;
+				result.Resource = resource;
+				result.Date = date;
+				result.Bits = bits;
+				return result;
 			}
 		}
 		else if (version.Equals(TEXT("1")))
@@ -126,20 +270,26 @@ ULowEntryParsedHashcash* ULowEntryHashingHashcashLibrary::parse(const FString& H
 				if (date.GetYear() > 1)
 				{
 					int32 bits = FCString::Atoi(*parts[1]);
-					if (countLeadingZeroBits(ULowEntryExtendedStandardLibrary::Sha1(ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Hashcash))) >= bits)
+					TArray<uint8> bytes = ULowEntryExtendedStandardLibrary::StringToBytesUtf8(Hashcash);
+					FSHA1::HashBuffer(bytes.GetData(), bytes.Num(), result.Hash.Hash);
+					if (countLeadingZeroBits(result.Hash.Hash, FSHA1::DigestSize) >= bits)
 					{
 						FString resource = parts[3];
 						for (int32 i = 4; i < (parts.Num() - 3); i++)
 						{
 							resource += TEXT(":") + parts[i];
 						}
-						return ULowEntryParsedHashcash::Create(true, resource, date, bits);
+						result.Valid = true;
+						result.Resource = resource;
+						result.Date = date;
+						result.Bits = bits;
+						return result;
 					}
 				}
 			}
 		}
 	}
-	return ULowEntryParsedHashcash::Create(false, TEXT(""), FDateTime(0), 0);
+	return FLowEntryHashcashData();
 }
 
 
@@ -236,12 +386,12 @@ FDateTime ULowEntryHashingHashcashLibrary::parseDateString(const FString& date)
 }
 
 
-int32 ULowEntryHashingHashcashLibrary::countLeadingZeroBits(const TArray<uint8>& values)
+int32 ULowEntryHashingHashcashLibrary::countLeadingZeroBits(const uint8* values, const int32 length)
 {
 	int32 total = 0;
-	for (uint8 value : values)
+	for (int32 i = 0; i < length; i++)
 	{
-		uint8 ofbyte = countLeadingZeroBits(value);
+		uint8 ofbyte = countLeadingZeroBits(values[i]);
 		total += ofbyte;
 		if (ofbyte != 8)
 		{
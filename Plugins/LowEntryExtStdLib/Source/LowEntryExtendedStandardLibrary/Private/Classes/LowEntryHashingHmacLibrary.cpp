@@ -0,0 +1,254 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHashingHmacLibrary.h"
+
+
+ULowEntryHashingHmacLibrary::ULowEntryHashingHmacLibrary()
+{
+	SetKey(nullptr, 0, ELowEntryHmacAlgorithm::SHA256);
+}
+
+ULowEntryHashingHmacLibrary::ULowEntryHashingHmacLibrary(const uint8* Key, const int64 KeyLength, const ELowEntryHmacAlgorithm Algorithm0)
+{
+	SetKey(Key, KeyLength, Algorithm0);
+}
+
+
+void ULowEntryHashingHmacLibrary::SetKey(const uint8* Key, const int64 KeyLength, const ELowEntryHmacAlgorithm Algorithm0)
+{
+	switch (Algorithm0)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+	case ELowEntryHmacAlgorithm::SHA1:
+	case ELowEntryHmacAlgorithm::SHA256:
+	case ELowEntryHmacAlgorithm::SHA512:
+		Algorithm = Algorithm0;
+		break;
+	default:
+		Algorithm = ELowEntryHmacAlgorithm::SHA256;// defaults to SHA-256
+		break;
+	}
+
+	const int32 BlockSize = GetBlockSize(Algorithm);
+
+	TArray<uint8> KeyBytes;
+	if (KeyLength > BlockSize)
+	{
+		KeyBytes = Hash(Key, KeyLength, Algorithm);// key = hash(key)
+	}
+	else if ((Key != nullptr) && (KeyLength > 0))
+	{
+		KeyBytes.Append(Key, KeyLength);
+	}
+	KeyBytes.SetNumZeroed(BlockSize);// key = key + 0x00 (till KeyBytes has BlockSize length)
+
+	InnerKeyPad = KeyBytes;
+	OuterKeyPad = KeyBytes;
+	for (int32 i = 0; i < BlockSize; i++)
+	{
+		InnerKeyPad[i] ^= 0x36;// i_key_pad = 0x36 ^ key
+		OuterKeyPad[i] ^= 0x5c;// o_key_pad = 0x5c ^ key
+	}
+
+	KeyedInner = createState();
+	KeyedOuter = createState();
+	if (Algorithm != ELowEntryHmacAlgorithm::SHA1)
+	{
+		update(KeyedInner, InnerKeyPad.GetData(), InnerKeyPad.Num());
+		update(KeyedOuter, OuterKeyPad.GetData(), OuterKeyPad.Num());
+	}
+
+	Reset();
+}
+
+
+void ULowEntryHashingHmacLibrary::Update(const uint8* Bytes, const int64 Length)
+{
+	if ((Bytes == nullptr) || (Length <= 0))
+	{
+		return;
+	}
+	update(Inner, Bytes, Length);
+}
+
+TArray<uint8> ULowEntryHashingHmacLibrary::Final()
+{
+	TArray<uint8> InnerHash = digest(Inner);// hash(i_key_pad + message)
+
+	FHashState Outer;
+	if (Algorithm == ELowEntryHmacAlgorithm::SHA1)
+	{
+		Sha1.Update(OuterKeyPad.GetData(), OuterKeyPad.Num());
+	}
+	else
+	{
+		Outer = KeyedOuter;
+	}
+	update(Outer, InnerHash.GetData(), InnerHash.Num());
+	TArray<uint8> Result = digest(Outer);// hash(o_key_pad + hash(i_key_pad + message))
+
+	Reset();
+	return Result;
+}
+
+void ULowEntryHashingHmacLibrary::Reset()
+{
+	if (Algorithm == ELowEntryHmacAlgorithm::SHA1)
+	{
+		startSha1Inner();
+	}
+	else
+	{
+		Inner = KeyedInner;
+	}
+}
+
+TArray<uint8> ULowEntryHashingHmacLibrary::Sign(const uint8* Bytes, const int64 Length)
+{
+	Reset();
+	Update(Bytes, Length);
+	return Final();
+}
+
+bool ULowEntryHashingHmacLibrary::Verify(const uint8* Bytes, const int64 Length, const uint8* Hash, const int64 HashLength)
+{
+	TArray<uint8> Expected = Sign(Bytes, Length);
+	return ConstantTimeEquals(Expected.GetData(), Expected.Num(), Hash, HashLength);
+}
+
+
+ULowEntryHashingHmacLibrary::FHashState ULowEntryHashingHmacLibrary::createState() const
+{
+	FHashState State;
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		State.Emplace<FMD5>();
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		State.Emplace<ULowEntryHashingSha512Library>();
+		break;
+	default:
+		State.Emplace<ULowEntryHashingSha256Library>();
+		break;
+	}
+	return State;
+}
+
+void ULowEntryHashingHmacLibrary::update(FHashState& State, const uint8* Bytes, const int64 Length)
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		State.Get<FMD5>().Update(Bytes, Length);
+		break;
+	case ELowEntryHmacAlgorithm::SHA1:
+		Sha1.Update(Bytes, Length);
+		break;
+	case ELowEntryHmacAlgorithm::SHA512:
+		State.Get<ULowEntryHashingSha512Library>().Update(Bytes, Length);
+		break;
+	default:
+		State.Get<ULowEntryHashingSha256Library>().Update(Bytes, Length);
+		break;
+	}
+}
+
+TArray<uint8> ULowEntryHashingHmacLibrary::digest(FHashState& State)
+{
+	TArray<uint8> Result;
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		Result.SetNum(16);
+		State.Get<FMD5>().Final(Result.GetData());
+		return Result;
+	case ELowEntryHmacAlgorithm::SHA1:
+		Result.SetNum(FSHA1::DigestSize);
+		Sha1.Final();
+		Sha1.GetHash(Result.GetData());
+		Sha1.Reset();
+		return Result;
+	case ELowEntryHmacAlgorithm::SHA512:
+		return State.Get<ULowEntryHashingSha512Library>().Final();
+	default:
+		return State.Get<ULowEntryHashingSha256Library>().Final();
+	}
+}
+
+void ULowEntryHashingHmacLibrary::startSha1Inner()
+{
+	Sha1.Reset();
+	Sha1.Update(InnerKeyPad.GetData(), InnerKeyPad.Num());
+}
+
+
+int32 ULowEntryHashingHmacLibrary::GetBlockSize(const ELowEntryHmacAlgorithm Algorithm)
+{
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA1:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA256:
+		return 64;
+	case ELowEntryHmacAlgorithm::SHA512:
+		return 128;
+	default:
+		return 64;// defaults to SHA-256
+	}
+}
+
+TArray<uint8> ULowEntryHashingHmacLibrary::Hash(const uint8* Bytes, const int64 Length, const ELowEntryHmacAlgorithm Algorithm)
+{
+	TArray<uint8> Result;
+	switch (Algorithm)
+	{
+	case ELowEntryHmacAlgorithm::MD5:
+		{
+			FMD5 Hasher;
+			Hasher.Update(Bytes, Length);
+			Result.SetNum(16);
+			Hasher.Final(Result.GetData());
+			return Result;
+		}
+	case ELowEntryHmacAlgorithm::SHA1:
+		{
+			FSHA1 Hasher;
+			Hasher.Update(Bytes, Length);
+			Hasher.Final();
+			Result.SetNum(FSHA1::DigestSize);
+			Hasher.GetHash(Result.GetData());
+			return Result;
+		}
+	case ELowEntryHmacAlgorithm::SHA512:
+		{
+			ULowEntryHashingSha512Library Hasher;
+			Hasher.Update(Bytes, Length);
+			return Hasher.Final();
+		}
+	default:
+		{
+			ULowEntryHashingSha256Library Hasher;
+			Hasher.Update(Bytes, Length);
+			return Hasher.Final();
+		}
+	}
+}
+
+bool ULowEntryHashingHmacLibrary::ConstantTimeEquals(const uint8* A, const int64 ALength, const uint8* B, const int64 BLength)
+{
+	if (ALength != BLength)
+	{
+		return false;// the length of a hash isn't a secret
+	}
+	uint8 Difference = 0;
+	for (int64 i = 0; i < ALength; i++)
+	{
+		Difference |= A[i] ^ B[i];
+	}
+	return (Difference == 0);
+}
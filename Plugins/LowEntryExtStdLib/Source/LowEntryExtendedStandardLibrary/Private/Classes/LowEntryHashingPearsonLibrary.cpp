@@ -35,14 +35,60 @@ TArray<uint8> ULowEntryHashingPearsonLibrary::Hash(const TArray<uint8>& Bytes, i
 		return hh;
 	}
 
-	for (int32 j = 0; j < HashLength; j++)
+	// lanes that are 256 apart start with the same value, so they always end up with the same value as well
+	const int32 lanes = FMath::Min(HashLength, 256);
+	const uint8 first = Bytes[Index];
+	for (int32 j = 0; j < lanes; j++)
 	{
-		uint8 h = pearson[(Bytes[Index] + j) & 0xff];
-		for (int32 i = 1; i < Length; i++)
+		hh[j] = pearson[(first + j) & 0xff];
+	}
+
+	// the input bytes are read as Bytes[(Index + i) & 0xff] (this has always been the case, and changing it would change the hashes), so after 256 bytes the same bytes are read again
+	// if that happens often enough, it's cheaper to first work out where every possible value ends up after a full cycle of 256 bytes, after which every lane only needs a single lookup per cycle
+	const int32 steps = Length - 1;
+	const int32 cycles = steps / 256;
+	const int32 start = (Index + 1) & 0xff;
+	if ((cycles > 0) && ((static_cast<int64>(lanes) * (cycles - 1) * 256) > (256 * 256)))
+	{
+		uint8 cycle[256];
+		for (int32 x = 0; x < 256; x++)
 		{
-			h = pearson[(h ^ Bytes[(Index + i) & 0xff]) & 0xff];
+			cycle[x] = static_cast<uint8>(x);
 		}
-		hh[j] = h;
+		advance(cycle, 256, Bytes.GetData(), start, 256);
+
+		for (int32 j = 0; j < lanes; j++)
+		{
+			uint8 h = hh[j];
+			for (int32 c = 0; c < cycles; c++)
+			{
+				h = cycle[h];
+			}
+			hh[j] = h;
+		}
+		advance(hh.GetData(), lanes, Bytes.GetData(), start, steps - (cycles * 256));
+	}
+	else
+	{
+		advance(hh.GetData(), lanes, Bytes.GetData(), start, steps);
+	}
+
+	for (int32 j = lanes; j < HashLength; j++)
+	{
+		hh[j] = hh[j - 256];
 	}
 	return hh;
 }
+
+void ULowEntryHashingPearsonLibrary::advance(uint8* lanes, const int32 laneCount, const uint8* bytes, const int32 start, const int32 count)
+{
+	// all lanes are advanced together, so every input byte is only read once, no matter how many lanes there are
+	for (int32 i = 0; i < count; i++)
+	{
+		const uint8 b = bytes[(start + i) & 0xff];
+		for (int32 j = 0; j < laneCount; j++)
+		{
+			lanes[j] = pearson[lanes[j] ^ b];
+		}
+	}
+}
@@ -2,17 +2,125 @@
 
 #include "LowEntryHashingSha256Library.h"
 
+#include "HAL/FileManager.h"
+
+#if PLATFORM_CPU_X86_FAMILY && (defined(_MSC_VER) || defined(__clang__) || defined(__GNUC__))
+	#define LOWENTRY_SHA256_SHANI 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+	#if defined(__clang__) || defined(__GNUC__)
+		#define LOWENTRY_SHA256_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+	#else
+		#define LOWENTRY_SHA256_SHANI_TARGET
+	#endif
+#else
+	#define LOWENTRY_SHA256_SHANI 0
+#endif
+
 
 constexpr int32 ULowEntryHashingSha256Library::k[64] = {0x428a2f98, 0x71374491, static_cast<int32>(0xb5c0fbcf), static_cast<int32>(0xe9b5dba5), 0x3956c25b, 0x59f111f1, static_cast<int32>(0x923f82a4), static_cast<int32>(0xab1c5ed5), static_cast<int32>(0xd807aa98), 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, static_cast<int32>(0x80deb1fe), static_cast<int32>(0x9bdc06a7), static_cast<int32>(0xc19bf174), static_cast<int32>(0xe49b69c1), static_cast<int32>(0xefbe4786), 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, static_cast<int32>(0x983e5152), static_cast<int32>(0xa831c66d), static_cast<int32>(0xb00327c8), static_cast<int32>(0xbf597fc7), static_cast<int32>(0xc6e00bf3), static_cast<int32>(0xd5a79147), 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, static_cast<int32>(0x81c2c92e), static_cast<int32>(0x92722c85), static_cast<int32>(0xa2bfe8a1), static_cast<int32>(0xa81a664b), static_cast<int32>(0xc24b8b70), static_cast<int32>(0xc76c51a3), static_cast<int32>(0xd192e819), static_cast<int32>(0xd6990624), static_cast<int32>(0xf40e3585), 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, static_cast<int32>(0x84c87814), static_cast<int32>(0x8cc70208), static_cast<int32>(0x90befffa), static_cast<int32>(0xa4506ceb), static_cast<int32>(0xbef9a3f7), static_cast<int32>(0xc67178f2)};
 
 
+#if LOWENTRY_SHA256_SHANI
+static bool LowEntrySha256DetectShaNi()
+{
+	int32 Info1[4] = {0, 0, 0, 0};
+	int32 Info7[4] = {0, 0, 0, 0};
+	#if defined(_MSC_VER)
+	__cpuid(Info1, 0);
+	if (Info1[0] < 7)
+	{
+		return false;
+	}
+	__cpuidex(Info1, 1, 0);
+	__cpuidex(Info7, 7, 0);
+	#else
+	if (__get_cpuid_max(0, nullptr) < 7)
+	{
+		return false;
+	}
+	__cpuid_count(1, 0, Info1[0], Info1[1], Info1[2], Info1[3]);
+	__cpuid_count(7, 0, Info7[0], Info7[1], Info7[2], Info7[3]);
+	#endif
+	const bool bSsse3 = ((Info1[2] & (1 << 9)) != 0);
+	const bool bSse41 = ((Info1[2] & (1 << 19)) != 0);
+	const bool bSha = ((Info7[1] & (1 << 29)) != 0);
+	return bSsse3 && bSse41 && bSha;
+}
+
+LOWENTRY_SHA256_SHANI_TARGET static void LowEntrySha256CompressShaNi(uint32* State, const int32* K, const uint8* In, int64 Blocks)
+{
+	const __m128i Mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+	__m128i Tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State));
+	__m128i State1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + 4));
+	Tmp = _mm_shuffle_epi32(Tmp, 0xB1);// CDAB
+	State1 = _mm_shuffle_epi32(State1, 0x1B);// EFGH
+	__m128i State0 = _mm_alignr_epi8(Tmp, State1, 8);// ABEF
+	State1 = _mm_blend_epi16(State1, Tmp, 0xF0);// CDGH
+
+	for (; Blocks > 0; Blocks--)
+	{
+		const __m128i SavedState0 = State0;
+		const __m128i SavedState1 = State1;
+
+		__m128i Msg[4];
+		for (int32 g = 0; g < 4; g++)
+		{
+			Msg[g] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(In + (g * 16))), Mask);
+		}
+		for (int32 g = 0; g < 16; g++)
+		{
+			if (g >= 4)
+			{
+				// Msg[g & 3] holds w[g - 4], the other three hold w[g - 3], w[g - 2] and w[g - 1]
+				__m128i Next = _mm_sha256msg1_epu32(Msg[g & 3], Msg[(g + 1) & 3]);
+				Next = _mm_add_epi32(Next, _mm_alignr_epi8(Msg[(g + 3) & 3], Msg[(g + 2) & 3], 4));
+				Msg[g & 3] = _mm_sha256msg2_epu32(Next, Msg[(g + 3) & 3]);
+			}
+			__m128i Round = _mm_add_epi32(Msg[g & 3], _mm_loadu_si128(reinterpret_cast<const __m128i*>(K + (g * 4))));
+			State1 = _mm_sha256rnds2_epu32(State1, State0, Round);
+			Round = _mm_shuffle_epi32(Round, 0x0E);
+			State0 = _mm_sha256rnds2_epu32(State0, State1, Round);
+		}
+
+		State0 = _mm_add_epi32(State0, SavedState0);
+		State1 = _mm_add_epi32(State1, SavedState1);
+		In += 64;
+	}
+
+	Tmp = _mm_shuffle_epi32(State0, 0x1B);// FEBA
+	State1 = _mm_shuffle_epi32(State1, 0xB1);// DCHG
+	State0 = _mm_blend_epi16(Tmp, State1, 0xF0);// DCBA
+	State1 = _mm_alignr_epi8(State1, Tmp, 8);// HGFE
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State), State0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(State + 4), State1);
+}
+#endif
+
+
 void ULowEntryHashingSha256Library::initialize()
 {
 	w.SetNum(64);
 	buffer.SetNum(64);
+
+	h0 = 0x6a09e667;
+	h1 = static_cast<int32>(0xbb67ae85);
+	h2 = 0x3c6ef372;
+	h3 = static_cast<int32>(0xa54ff53a);
+	h4 = 0x510e527f;
+	h5 = static_cast<int32>(0x9b05688c);
+	h6 = 0x1f83d9ab;
+	h7 = 0x5be0cd19;
+
+	count = 0;
 }
 
-void ULowEntryHashingSha256Library::update(const TArray<uint8>& b, const int64 offset, const int64 len)
+void ULowEntryHashingSha256Library::update(const uint8* b, const int64 len)
 {
 	int32 n = count % BLOCK_SIZE;
 	count += len;
@@ -21,31 +129,24 @@ void ULowEntryHashingSha256Library::update(const TArray<uint8>& b, const int64 o
 
 	if (len >= partLen)
 	{
-		for (int32 index = 0; index < partLen; index++)
-		{
-			buffer[n + index] = b[offset + index];
-		}
-		sha(buffer, 0);
-		for (i = partLen; ((i + BLOCK_SIZE) - 1) < len; i += BLOCK_SIZE)
-		{
-			sha(b, offset + i);
-		}
+		FMemory::Memcpy(buffer.GetData() + n, b, partLen);
+		shaBlocks(buffer.GetData(), 1);
+		const int64 blocks = (len - partLen) / BLOCK_SIZE;
+		shaBlocks(b + partLen, blocks);
+		i = partLen + (blocks * BLOCK_SIZE);
 		n = 0;
 	}
 
 	if (i < len)
 	{
-		for (int32 index = 0; index < len - i; index++)
-		{
-			buffer[n + index] = b[offset + i + index];
-		}
+		FMemory::Memcpy(buffer.GetData() + n, b + i, len - i);
 	}
 }
 
 TArray<uint8> ULowEntryHashingSha256Library::digest()
 {
 	TArray<uint8> tail = padBuffer();
-	update(tail, 0, tail.Num());
+	update(tail.GetData(), tail.Num());
 	return getResult();
 }
 
@@ -116,8 +217,40 @@ TArray<uint8> ULowEntryHashingSha256Library::getResult()
 	return result;
 }
 
-void ULowEntryHashingSha256Library::sha(const TArray<uint8>& in, int64 offset)
+void ULowEntryHashingSha256Library::shaBlocks(const uint8* in, const int64 blocks)
 {
+	if (blocks <= 0)
+	{
+		return;
+	}
+
+#if LOWENTRY_SHA256_SHANI
+	static const bool bShaNi = LowEntrySha256DetectShaNi();
+	if (bShaNi)
+	{
+		uint32 State[8] = {static_cast<uint32>(h0), static_cast<uint32>(h1), static_cast<uint32>(h2), static_cast<uint32>(h3), static_cast<uint32>(h4), static_cast<uint32>(h5), static_cast<uint32>(h6), static_cast<uint32>(h7)};
+		LowEntrySha256CompressShaNi(State, k, in, blocks);
+		h0 = static_cast<int32>(State[0]);
+		h1 = static_cast<int32>(State[1]);
+		h2 = static_cast<int32>(State[2]);
+		h3 = static_cast<int32>(State[3]);
+		h4 = static_cast<int32>(State[4]);
+		h5 = static_cast<int32>(State[5]);
+		h6 = static_cast<int32>(State[6]);
+		h7 = static_cast<int32>(State[7]);
+		return;
+	}
+#endif
+
+	for (int64 block = 0; block < blocks; block++)
+	{
+		sha(in + (block * BLOCK_SIZE));
+	}
+}
+
+void ULowEntryHashingSha256Library::sha(const uint8* in)
+{
+	int64 offset = 0;
 	int32 A = h0;
 	int32 B = h1;
 	int32 C = h2;
@@ -171,11 +304,37 @@ int32 ULowEntryHashingSha256Library::s(const int32 a, const int32 b)
 }
 
 
+ULowEntryHashingSha256Library::ULowEntryHashingSha256Library()
+{
+	initialize();
+}
+
+void ULowEntryHashingSha256Library::Update(const uint8* Bytes, const int64 Length)
+{
+	if ((Bytes == nullptr) || (Length <= 0))
+	{
+		return;
+	}
+	update(Bytes, Length);
+}
+
+TArray<uint8> ULowEntryHashingSha256Library::Final()
+{
+	TArray<uint8> Result = digest();
+	initialize();
+	return Result;
+}
+
+void ULowEntryHashingSha256Library::Reset()
+{
+	initialize();
+}
+
+
 TArray<uint8> ULowEntryHashingSha256Library::Hash(const TArray<uint8>& Bytes)
 {
 	ULowEntryHashingSha256Library instance = ULowEntryHashingSha256Library();
-	instance.initialize();
-	instance.update(Bytes, 0, Bytes.Num());
+	instance.Update(Bytes.GetData(), Bytes.Num());
 	return instance.digest();
 }
 
@@ -184,7 +343,6 @@ TArray<uint8> ULowEntryHashingSha256Library::Hash(const TArray<uint8>& Bytes, in
 	if (Bytes.Num() <= 0)
 	{
 		ULowEntryHashingSha256Library instance = ULowEntryHashingSha256Library();
-		instance.initialize();
 		return instance.digest();
 	}
 
@@ -201,12 +359,40 @@ TArray<uint8> ULowEntryHashingSha256Library::Hash(const TArray<uint8>& Bytes, in
 	if (Length <= 0)
 	{
 		ULowEntryHashingSha256Library instance = ULowEntryHashingSha256Library();
-		instance.initialize();
 		return instance.digest();
 	}
 
 	ULowEntryHashingSha256Library instance = ULowEntryHashingSha256Library();
-	instance.initialize();
-	instance.update(Bytes, Index, Length);
+	instance.Update(Bytes.GetData() + Index, Length);
 	return instance.digest();
 }
+
+bool ULowEntryHashingSha256Library::HashFile(const FString& FilePath, TArray<uint8>& OutHash)
+{
+	OutHash.Empty();
+
+	const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	ULowEntryHashingSha256Library instance = ULowEntryHashingSha256Library();
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(FILE_CHUNK_SIZE);
+	int64 Remaining = Reader->TotalSize();
+	while (Remaining > 0)
+	{
+		const int64 ChunkLength = FMath::Min(Remaining, static_cast<int64>(FILE_CHUNK_SIZE));
+		Reader->Serialize(Chunk.GetData(), ChunkLength);
+		if (Reader->IsError())
+		{
+			return false;
+		}
+		instance.update(Chunk.GetData(), ChunkLength);
+		Remaining -= ChunkLength;
+	}
+
+	OutHash = instance.digest();
+	return true;
+}
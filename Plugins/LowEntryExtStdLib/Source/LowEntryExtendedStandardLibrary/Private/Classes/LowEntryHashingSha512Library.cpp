@@ -2,6 +2,8 @@
 
 #include "LowEntryHashingSha512Library.h"
 
+#include "HAL/FileManager.h"
+
 
 constexpr int64 ULowEntryHashingSha512Library::k[80] = {0x428a2f98d728ae22, 0x7137449123ef65cd, static_cast<int64>(0xb5c0fbcfec4d3b2f), static_cast<int64>(0xe9b5dba58189dbbc), 0x3956c25bf348b538, 0x59f111f1b605d019, static_cast<int64>(0x923f82a4af194f9b), static_cast<int64>(0xab1c5ed5da6d8118), static_cast<int64>(0xd807aa98a3030242), 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, static_cast<int64>(0x80deb1fe3b1696b1), static_cast<int64>(0x9bdc06a725c71235), static_cast<int64>(0xc19bf174cf692694), static_cast<int64>(0xe49b69c19ef14ad2), static_cast<int64>(0xefbe4786384f25e3), 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, static_cast<int64>(0x983e5152ee66dfab), static_cast<int64>(0xa831c66d2db43210), static_cast<int64>(0xb00327c898fb213f), static_cast<int64>(0xbf597fc7beef0ee4), static_cast<int64>(0xc6e00bf33da88fc2), static_cast<int64>(0xd5a79147930aa725), 0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, static_cast<int64>(0x81c2c92e47edaee6), static_cast<int64>(0x92722c851482353b), static_cast<int64>(0xa2bfe8a14cf10364), static_cast<int64>(0xa81a664bbc423001), static_cast<int64>(0xc24b8b70d0f89791), static_cast<int64>(0xc76c51a30654be30), static_cast<int64>(0xd192e819d6ef5218), static_cast<int64>(0xd69906245565a910), static_cast<int64>(0xf40e35855771202a), 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, static_cast<int64>(0x84c87814a1f0ab72), static_cast<int64>(0x8cc702081a6439ec), static_cast<int64>(0x90befffa23631e28), static_cast<int64>(0xa4506cebde82bde9), static_cast<int64>(0xbef9a3f7b2c67915), static_cast<int64>(0xc67178f2e372532b), static_cast<int64>(0xca273eceea26619c), static_cast<int64>(0xd186b8c721c0c207), static_cast<int64>(0xeada7dd6cde0eb1e), static_cast<int64>(0xf57d4f7fee6ed178), 0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817};
 
@@ -10,9 +12,20 @@ void ULowEntryHashingSha512Library::initialize()
 {
 	w.SetNum(80);
 	buffer.SetNum(128);
+
+	h0 = 0x6a09e667f3bcc908L;
+	h1 = static_cast<int64>(0xbb67ae8584caa73bL);
+	h2 = 0x3c6ef372fe94f82bL;
+	h3 = static_cast<int64>(0xa54ff53a5f1d36f1L);
+	h4 = 0x510e527fade682d1L;
+	h5 = static_cast<int64>(0x9b05688c2b3e6c1fL);
+	h6 = 0x1f83d9abfb41bd6bL;
+	h7 = 0x5be0cd19137e2179L;
+
+	count = 0;
 }
 
-void ULowEntryHashingSha512Library::update(const TArray<uint8>& b, const int64 offset, const int64 len)
+void ULowEntryHashingSha512Library::update(const uint8* b, const int64 len)
 {
 	int32 n = count % BLOCK_SIZE;
 	count += len;
@@ -21,31 +34,25 @@ void ULowEntryHashingSha512Library::update(const TArray<uint8>& b, const int64 o
 
 	if (len >= partLen)
 	{
-		for (int32 index = 0; index < partLen; index++)
-		{
-			buffer[n + index] = b[offset + index];
-		}
-		sha(buffer, 0);
+		FMemory::Memcpy(buffer.GetData() + n, b, partLen);
+		sha(buffer.GetData());
 		for (i = partLen; ((i + BLOCK_SIZE) - 1) < len; i += BLOCK_SIZE)
 		{
-			sha(b, offset + i);
+			sha(b + i);
 		}
 		n = 0;
 	}
 
 	if (i < len)
 	{
-		for (int32 index = 0; index < len - i; index++)
-		{
-			buffer[n + index] = b[offset + i + index];
-		}
+		FMemory::Memcpy(buffer.GetData() + n, b + i, len - i);
 	}
 }
 
 TArray<uint8> ULowEntryHashingSha512Library::digest()
 {
 	TArray<uint8> tail = padBuffer();
-	update(tail, 0, tail.Num());
+	update(tail.GetData(), tail.Num());
 	return getResult();
 }
 
@@ -149,8 +156,9 @@ TArray<uint8> ULowEntryHashingSha512Library::getResult()
 	return result;
 }
 
-void ULowEntryHashingSha512Library::sha(const TArray<uint8>& in, int64 offset)
+void ULowEntryHashingSha512Library::sha(const uint8* in)
 {
+	int64 offset = 0;
 	int64 A = h0;
 	int64 B = h1;
 	int64 C = h2;
@@ -204,11 +212,37 @@ int64 ULowEntryHashingSha512Library::s(const int64 a, const int32 b)
 }
 
 
+ULowEntryHashingSha512Library::ULowEntryHashingSha512Library()
+{
+	initialize();
+}
+
+void ULowEntryHashingSha512Library::Update(const uint8* Bytes, const int64 Length)
+{
+	if ((Bytes == nullptr) || (Length <= 0))
+	{
+		return;
+	}
+	update(Bytes, Length);
+}
+
+TArray<uint8> ULowEntryHashingSha512Library::Final()
+{
+	TArray<uint8> Result = digest();
+	initialize();
+	return Result;
+}
+
+void ULowEntryHashingSha512Library::Reset()
+{
+	initialize();
+}
+
+
 TArray<uint8> ULowEntryHashingSha512Library::Hash(const TArray<uint8>& Bytes)
 {
 	ULowEntryHashingSha512Library instance = ULowEntryHashingSha512Library();
-	instance.initialize();
-	instance.update(Bytes, 0, Bytes.Num());
+	instance.Update(Bytes.GetData(), Bytes.Num());
 	return instance.digest();
 }
 
@@ -217,7 +251,6 @@ TArray<uint8> ULowEntryHashingSha512Library::Hash(const TArray<uint8>& Bytes, in
 	if (Bytes.Num() <= 0)
 	{
 		ULowEntryHashingSha512Library instance = ULowEntryHashingSha512Library();
-		instance.initialize();
 		return instance.digest();
 	}
 
@@ -234,12 +267,40 @@ TArray<uint8> ULowEntryHashingSha512Library::Hash(const TArray<uint8>& Bytes, in
 	if (Length <= 0)
 	{
 		ULowEntryHashingSha512Library instance = ULowEntryHashingSha512Library();
-		instance.initialize();
 		return instance.digest();
 	}
 
 	ULowEntryHashingSha512Library instance = ULowEntryHashingSha512Library();
-	instance.initialize();
-	instance.update(Bytes, Index, Length);
+	instance.Update(Bytes.GetData() + Index, Length);
 	return instance.digest();
 }
+
+bool ULowEntryHashingSha512Library::HashFile(const FString& FilePath, TArray<uint8>& OutHash)
+{
+	OutHash.Empty();
+
+	const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	ULowEntryHashingSha512Library instance = ULowEntryHashingSha512Library();
+	TArray<uint8> Chunk;
+	Chunk.SetNumUninitialized(FILE_CHUNK_SIZE);
+	int64 Remaining = Reader->TotalSize();
+	while (Remaining > 0)
+	{
+		const int64 ChunkLength = FMath::Min(Remaining, static_cast<int64>(FILE_CHUNK_SIZE));
+		Reader->Serialize(Chunk.GetData(), ChunkLength);
+		if (Reader->IsError())
+		{
+			return false;
+		}
+		instance.update(Chunk.GetData(), ChunkLength);
+		Remaining -= ChunkLength;
+	}
+
+	OutHash = instance.digest();
+	return true;
+}
@@ -0,0 +1,74 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryHmacContext.h"
+#include "LowEntryByteRope.h"
+
+
+ULowEntryHmacContext::ULowEntryHmacContext(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryHmacContext* ULowEntryHmacContext::Create(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm)
+{
+	ULowEntryHmacContext* Instance = NewObject<ULowEntryHmacContext>();
+	Instance->Hasher.SetKey(Key.GetData(), Key.Num(), Algorithm);
+	return Instance;
+}
+
+
+void ULowEntryHmacContext::Update(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	if (ByteArray.Num() <= 0)
+	{
+		return;
+	}
+
+	if (Index < 0)
+	{
+		Length += Index;
+		Index = 0;
+	}
+	if (Length > (ByteArray.Num() - Index))
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return;
+	}
+
+	Hasher.Update(ByteArray.GetData() + Index, Length);
+}
+
+void ULowEntryHmacContext::UpdateRope(ULowEntryByteRope* Rope)
+{
+	if (Rope == nullptr)
+	{
+		return;
+	}
+	Rope->Chain.ForEachFragment([this](const TArrayView<const uint8>& Fragment)
+	{
+		Hasher.Update(Fragment.GetData(), Fragment.Num());
+	});
+}
+
+TArray<uint8> ULowEntryHmacContext::Final()
+{
+	return Hasher.Final();
+}
+
+void ULowEntryHmacContext::Reset()
+{
+	Hasher.Reset();
+}
+
+TArray<uint8> ULowEntryHmacContext::Sign(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	Hasher.Reset();
+	Update(ByteArray, Index, Length);
+	return Hasher.Final();
+}
+
+bool ULowEntryHmacContext::Verify(const TArray<uint8>& ByteArray, const TArray<uint8>& Hash, int32 Index, int32 Length)
+{
+	TArray<uint8> Expected = Sign(ByteArray, Index, Length);
+	return ULowEntryHashingHmacLibrary::ConstantTimeEquals(Expected.GetData(), Expected.Num(), Hash.GetData(), Hash.Num());
+}
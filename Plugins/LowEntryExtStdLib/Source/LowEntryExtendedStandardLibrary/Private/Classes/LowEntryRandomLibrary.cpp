@@ -0,0 +1,339 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryRandomLibrary.h"
+
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/Guid.h"
+
+#if PLATFORM_WINDOWS
+	#include "Windows/WindowsHWrapper.h"
+	#include "Windows/AllowWindowsPlatformTypes.h"
+	#include <bcrypt.h>
+	#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_APPLE
+	#include <stdlib.h>
+#elif PLATFORM_LINUX
+	#include <sys/random.h>
+	#include <errno.h>
+#else
+	#include <stdio.h>
+#endif
+
+
+namespace LowEntryRandomLibrary
+{
+	/** The amount of keystream bytes that are generated at once for small requests, the first 44 of them become the next key and nonce. */
+	const int32 BUFFER_SIZE = 1024;
+	const int32 KEY_SIZE = 32;
+	const int32 NONCE_SIZE = 12;
+
+	/** After this many bytes, the operating system is asked for a new seed. */
+	const int64 RESEED_INTERVAL = 64 * 1024 * 1024;
+
+	bool GetOperatingSystemRandomBytes(uint8* Bytes, const int32 Length)
+	{
+#if PLATFORM_WINDOWS
+		return BCRYPT_SUCCESS(BCryptGenRandom(nullptr, Bytes, static_cast<ULONG>(Length), BCRYPT_USE_SYSTEM_PREFERRED_RNG));
+#elif PLATFORM_APPLE
+		arc4random_buf(Bytes, Length);
+		return true;
+#elif PLATFORM_LINUX
+		int32 Offset = 0;
+		while (Offset < Length)
+		{
+			const ssize_t Count = getrandom(Bytes + Offset, Length - Offset, 0);
+			if (Count < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+				return false;
+			}
+			Offset += static_cast<int32>(Count);
+		}
+		return true;
+#else
+		FILE* File = fopen("/dev/urandom", "rb");
+		if (File == nullptr)
+		{
+			return false;
+		}
+		const bool Success = (fread(Bytes, 1, Length, File) == static_cast<size_t>(Length));
+		fclose(File);
+		return Success;
+#endif
+	}
+
+	FORCEINLINE uint32 Rotate(const uint32 Value, const int32 Bits)
+	{
+		return (Value << Bits) | (Value >> (32 - Bits));
+	}
+
+	FORCEINLINE void QuarterRound(uint32& A, uint32& B, uint32& C, uint32& D)
+	{
+		A += B;
+		D = Rotate(D ^ A, 16);
+		C += D;
+		B = Rotate(B ^ C, 12);
+		A += B;
+		D = Rotate(D ^ A, 8);
+		C += D;
+		B = Rotate(B ^ C, 7);
+	}
+
+	FORCEINLINE uint32 ReadUint32(const uint8* Bytes)
+	{
+		return static_cast<uint32>(Bytes[0]) | (static_cast<uint32>(Bytes[1]) << 8) | (static_cast<uint32>(Bytes[2]) << 16) | (static_cast<uint32>(Bytes[3]) << 24);
+	}
+
+	FORCEINLINE void WriteUint32(uint8* Bytes, const uint32 Value)
+	{
+		Bytes[0] = static_cast<uint8>(Value);
+		Bytes[1] = static_cast<uint8>(Value >> 8);
+		Bytes[2] = static_cast<uint8>(Value >> 16);
+		Bytes[3] = static_cast<uint8>(Value >> 24);
+	}
+
+	/** A ChaCha20 (RFC 8439) keystream with fast key erasure: whenever the buffer is refilled, the start of it replaces the key and nonce. */
+	struct FSecureStream
+	{
+		uint32 State[16];
+		uint8 Buffer[BUFFER_SIZE];
+		int32 Available = 0;
+		int64 SinceSeed = 0;
+		bool Seeded = false;
+
+		void Block(uint8* Output)
+		{
+			uint32 X[16];
+			FMemory::Memcpy(X, State, sizeof(X));
+			for (int32 i = 0; i < 10; i++)
+			{
+				QuarterRound(X[0], X[4], X[8], X[12]);
+				QuarterRound(X[1], X[5], X[9], X[13]);
+				QuarterRound(X[2], X[6], X[10], X[14]);
+				QuarterRound(X[3], X[7], X[11], X[15]);
+				QuarterRound(X[0], X[5], X[10], X[15]);
+				QuarterRound(X[1], X[6], X[11], X[12]);
+				QuarterRound(X[2], X[7], X[8], X[13]);
+				QuarterRound(X[3], X[4], X[9], X[14]);
+			}
+			for (int32 i = 0; i < 16; i++)
+			{
+				WriteUint32(Output + (i * 4), X[i] + State[i]);
+			}
+			State[12]++;
+		}
+
+		void SetKey(const uint8* KeyAndNonce)
+		{
+			State[0] = 0x61707865;
+			State[1] = 0x3320646e;
+			State[2] = 0x79622d32;
+			State[3] = 0x6b206574;
+			for (int32 i = 0; i < 8; i++)
+			{
+				State[4 + i] = ReadUint32(KeyAndNonce + (i * 4));
+			}
+			State[12] = 0;
+			for (int32 i = 0; i < 3; i++)
+			{
+				State[13 + i] = ReadUint32(KeyAndNonce + KEY_SIZE + (i * 4));
+			}
+		}
+
+		void Refill()
+		{
+			for (int32 i = 0; i < BUFFER_SIZE; i += 64)
+			{
+				Block(Buffer + i);
+			}
+			SetKey(Buffer);
+			FMemory::Memzero(Buffer, KEY_SIZE + NONCE_SIZE);
+			Available = BUFFER_SIZE - (KEY_SIZE + NONCE_SIZE);
+		}
+
+		void Seed()
+		{
+			uint8 Seed[KEY_SIZE + NONCE_SIZE];
+			if (!GetOperatingSystemRandomBytes(Seed, sizeof(Seed)))
+			{
+				// should never happen, but don't end up with a predictable stream if it does
+				const FGuid Guid = FGuid::NewGuid();
+				const uint64 Cycles = FPlatformTime::Cycles64();
+				const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+				const uint64 Address = reinterpret_cast<uint64>(this);
+				FMemory::Memcpy(Seed, &Guid, sizeof(Guid));
+				FMemory::Memcpy(Seed + 16, &Cycles, sizeof(Cycles));
+				FMemory::Memcpy(Seed + 24, &ThreadId, sizeof(ThreadId));
+				FMemory::Memcpy(Seed + 28, &Address, sizeof(Address));
+				FMemory::Memcpy(Seed + 36, &Cycles, sizeof(Cycles));
+			}
+			if (Seeded)
+			{
+				// mix the new seed into the current key, rather than replacing it
+				uint8 Current[KEY_SIZE + NONCE_SIZE];
+				Block(Buffer);
+				FMemory::Memcpy(Current, Buffer, sizeof(Current));
+				for (int32 i = 0; i < static_cast<int32>(sizeof(Seed)); i++)
+				{
+					Seed[i] ^= Current[i];
+				}
+				FMemory::Memzero(Current, sizeof(Current));
+			}
+			SetKey(Seed);
+			FMemory::Memzero(Seed, sizeof(Seed));
+			Refill();
+			SinceSeed = 0;
+			Seeded = true;
+		}
+
+		void Fill(uint8* Bytes, int64 Length)
+		{
+			if (!Seeded || (SinceSeed >= RESEED_INTERVAL))
+			{
+				Seed();
+			}
+			SinceSeed += Length;
+
+			const int32 FromBuffer = static_cast<int32>(FMath::Min<int64>(Length, Available));
+			if (FromBuffer > 0)
+			{
+				uint8* Source = Buffer + (BUFFER_SIZE - Available);
+				FMemory::Memcpy(Bytes, Source, FromBuffer);
+				FMemory::Memzero(Source, FromBuffer);
+				Available -= FromBuffer;
+				Bytes += FromBuffer;
+				Length -= FromBuffer;
+			}
+			if (Length <= 0)
+			{
+				return;
+			}
+
+			// the current key hasn't produced any output yet, so large requests are written into the destination directly
+			while (Length >= 64)
+			{
+				Block(Bytes);
+				Bytes += 64;
+				Length -= 64;
+			}
+			Refill();
+			if (Length > 0)
+			{
+				uint8* Source = Buffer + (BUFFER_SIZE - Available);
+				FMemory::Memcpy(Bytes, Source, Length);
+				FMemory::Memzero(Source, Length);
+				Available -= static_cast<int32>(Length);
+			}
+		}
+	};
+
+	/** xoshiro256** (D. Blackman, S. Vigna), 8 bytes per step. */
+	struct FFastStream
+	{
+		uint64 S[4];
+		bool Seeded = false;
+
+		FORCEINLINE static uint64 Rotate64(const uint64 Value, const int32 Bits)
+		{
+			return (Value << Bits) | (Value >> (64 - Bits));
+		}
+
+		FORCEINLINE uint64 Next()
+		{
+			const uint64 Result = Rotate64(S[1] * 5, 7) * 9;
+			const uint64 T = S[1] << 17;
+			S[2] ^= S[0];
+			S[3] ^= S[1];
+			S[1] ^= S[2];
+			S[0] ^= S[3];
+			S[2] ^= T;
+			S[3] = Rotate64(S[3], 45);
+			return Result;
+		}
+
+		void Fill(uint8* Bytes, int64 Length);
+	};
+
+	FSecureStream& GetSecureStream()
+	{
+		thread_local FSecureStream Stream;
+		return Stream;
+	}
+
+	void FFastStream::Fill(uint8* Bytes, int64 Length)
+	{
+		if (!Seeded)
+		{
+			do
+			{
+				GetSecureStream().Fill(reinterpret_cast<uint8*>(S), sizeof(S));
+			}
+			while ((S[0] | S[1] | S[2] | S[3]) == 0);
+			Seeded = true;
+		}
+
+		for (; Length >= 8; Length -= 8)
+		{
+			const uint64 Value = Next();
+			FMemory::Memcpy(Bytes, &Value, 8);
+			Bytes += 8;
+		}
+		if (Length > 0)
+		{
+			const uint64 Value = Next();
+			FMemory::Memcpy(Bytes, &Value, Length);
+		}
+	}
+
+	FFastStream& GetFastStream()
+	{
+		thread_local FFastStream Stream;
+		return Stream;
+	}
+}
+
+
+void ULowEntryRandomLibrary::SecureRandomBytes(uint8* Bytes, const int64 Length)
+{
+	if (Length <= 0)
+	{
+		return;
+	}
+	LowEntryRandomLibrary::GetSecureStream().Fill(Bytes, Length);
+}
+
+void ULowEntryRandomLibrary::FastRandomBytes(uint8* Bytes, const int64 Length)
+{
+	if (Length <= 0)
+	{
+		return;
+	}
+	LowEntryRandomLibrary::GetFastStream().Fill(Bytes, Length);
+}
+
+
+TArray<uint8> ULowEntryRandomLibrary::SecureRandomBytes(const int32 Length)
+{
+	TArray<uint8> Bytes;
+	if (Length > 0)
+	{
+		Bytes.SetNumUninitialized(Length);
+		SecureRandomBytes(Bytes.GetData(), Length);
+	}
+	return Bytes;
+}
+
+TArray<uint8> ULowEntryRandomLibrary::FastRandomBytes(const int32 Length)
+{
+	TArray<uint8> Bytes;
+	if (Length > 0)
+	{
+		Bytes.SetNumUninitialized(Length);
+		FastRandomBytes(Bytes.GetData(), Length);
+	}
+	return Bytes;
+}
@@ -0,0 +1,66 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryRegex.h"
+#include "LowEntryRegexLibrary.h"
+
+
+ULowEntryRegex::ULowEntryRegex(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryRegex* ULowEntryRegex::Create(const FString& Pattern)
+{
+	ULowEntryRegex* Instance = NewObject<ULowEntryRegex>();
+	Instance->Pattern = Pattern;
+	Instance->CompiledPattern.Emplace(Pattern);
+	return Instance;
+}
+
+
+FString ULowEntryRegex::GetPattern()
+{
+	return Pattern;
+}
+
+bool ULowEntryRegex::Match(const FString& String)
+{
+	if (!CompiledPattern.IsSet())
+	{
+		return false;
+	}
+	return ULowEntryRegexLibrary::Match(CompiledPattern.GetValue(), String);
+}
+
+int32 ULowEntryRegex::Count(const FString& String)
+{
+	if (!CompiledPattern.IsSet())
+	{
+		return 0;
+	}
+	return ULowEntryRegexLibrary::Count(CompiledPattern.GetValue(), String);
+}
+
+TArray<FLowEntryRegexMatch> ULowEntryRegex::GetMatches(const FString& String)
+{
+	if (!CompiledPattern.IsSet())
+	{
+		return TArray<FLowEntryRegexMatch>();
+	}
+	return ULowEntryRegexLibrary::GetMatches(CompiledPattern.GetValue(), String, true);
+}
+
+TArray<FLowEntryRegexMatch> ULowEntryRegex::GetMatchOffsets(const FString& String)
+{
+	if (!CompiledPattern.IsSet())
+	{
+		return TArray<FLowEntryRegexMatch>();
+	}
+	return ULowEntryRegexLibrary::GetMatches(CompiledPattern.GetValue(), String, false);
+}
+
+FString ULowEntryRegex::Replace(const FString& String, const FString& Replacement)
+{
+	if (!CompiledPattern.IsSet())
+	{
+		return String;
+	}
+	return ULowEntryRegexLibrary::Replace(CompiledPattern.GetValue(), String, Replacement);
+}
@@ -0,0 +1,143 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryRegexLibrary.h"
+
+#include "Containers/LruCache.h"
+#include "Misc/ScopeLock.h"
+
+
+namespace LowEntryRegexLibrary
+{
+	FCriticalSection CacheLock;
+
+	TLruCache<FString, FRegexPattern>& GetCache()
+	{
+		static TLruCache<FString, FRegexPattern> Cache(ULowEntryRegexLibrary::CACHE_SIZE);
+		return Cache;
+	}
+}
+
+
+FRegexPattern ULowEntryRegexLibrary::GetCachedPattern(const FString& Pattern)
+{
+	FScopeLock Lock(&LowEntryRegexLibrary::CacheLock);
+	TLruCache<FString, FRegexPattern>& Cache = LowEntryRegexLibrary::GetCache();
+	if (const FRegexPattern* Cached = Cache.FindAndTouch(Pattern))
+	{
+		return *Cached;
+	}
+
+	// copies of a FRegexPattern share the same compiled pattern
+	FRegexPattern Compiled(Pattern);
+	Cache.Add(Pattern, Compiled);
+	return Compiled;
+}
+
+void ULowEntryRegexLibrary::ClearCache()
+{
+	FScopeLock Lock(&LowEntryRegexLibrary::CacheLock);
+	LowEntryRegexLibrary::GetCache().Empty(CACHE_SIZE);
+}
+
+
+bool ULowEntryRegexLibrary::Match(const FRegexPattern& Pattern, const FString& String)
+{
+	FRegexMatcher RegexMatcher(Pattern, String);
+	return RegexMatcher.FindNext();
+}
+
+int32 ULowEntryRegexLibrary::Count(const FRegexPattern& Pattern, const FString& String)
+{
+	FRegexMatcher RegexMatcher(Pattern, String);
+	int32 Count = 0;
+	int32 Length = String.Len();
+	while (RegexMatcher.FindNext())
+	{
+		Count++;
+		int32 e = RegexMatcher.GetMatchEnding();
+		RegexMatcher.SetLimits(e, Length);
+	}
+	return Count;
+}
+
+TArray<FLowEntryRegexMatch> ULowEntryRegexLibrary::GetMatches(const FRegexPattern& Pattern, const FString& String, const bool IncludeStrings)
+{
+	TArray<FLowEntryRegexMatch> Matches;
+
+	int32 Length = String.Len();
+	FRegexMatcher RegexMatcher(Pattern, String);
+	int32 MatchNumber = 0;
+	while (RegexMatcher.FindNext())
+	{
+		MatchNumber++;
+		int32 b = RegexMatcher.GetMatchBeginning();
+		int32 e = RegexMatcher.GetMatchEnding();
+		if ((b < 0) || (e < 0))
+		{
+			continue;
+		}
+
+		FLowEntryRegexMatch& Match = Matches.AddDefaulted_GetRef();
+		Match.MatchNumber = MatchNumber;
+		Match.BeginIndex = b;
+		Match.EndIndex = e;
+		if (IncludeStrings)
+		{
+			Match.Match = String.Mid(b, e - b);
+		}
+
+		int32 CaptureGroupNumber = 0;
+		while (true)
+		{
+			CaptureGroupNumber++;
+			int32 gb = RegexMatcher.GetCaptureGroupBeginning(CaptureGroupNumber);
+			int32 ge = RegexMatcher.GetCaptureGroupEnding(CaptureGroupNumber);
+			if ((gb < 0) || (ge < 0))
+			{
+				break;
+			}
+			FLowEntryRegexCaptureGroup& GroupMatch = Match.CaptureGroups.AddDefaulted_GetRef();
+			GroupMatch.CaptureGroupNumber = CaptureGroupNumber;
+			GroupMatch.BeginIndex = gb;
+			GroupMatch.EndIndex = ge;
+			if (IncludeStrings)
+			{
+				GroupMatch.Match = String.Mid(gb, ge - gb);
+			}
+		}
+
+		RegexMatcher.SetLimits(e, Length);
+	}
+
+	return Matches;
+}
+
+FString ULowEntryRegexLibrary::Replace(const FRegexPattern& Pattern, const FString& String, const FString& Replacement)
+{
+	int32 Length = String.Len();
+
+	FString Result;
+	Result.Reserve(Length);
+	int32 LastMatchEnding = 0;
+
+	FRegexMatcher RegexMatcher(Pattern, String);
+	while (RegexMatcher.FindNext())
+	{
+		int32 b = RegexMatcher.GetMatchBeginning();
+		int32 e = RegexMatcher.GetMatchEnding();
+
+		if (b > LastMatchEnding)
+		{
+			Result.AppendChars(*String + LastMatchEnding, b - LastMatchEnding);
+		}
+		Result += Replacement;
+
+		RegexMatcher.SetLimits(e, Length);
+		LastMatchEnding = e;
+	}
+	if (Length > LastMatchEnding)
+	{
+		Result.AppendChars(*String + LastMatchEnding, Length - LastMatchEnding);
+	}
+	return Result;
+}
@@ -0,0 +1,59 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntrySha256Hasher.h"
+#include "LowEntryByteRope.h"
+
+
+ULowEntrySha256Hasher::ULowEntrySha256Hasher(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntrySha256Hasher* ULowEntrySha256Hasher::Create()
+{
+	return NewObject<ULowEntrySha256Hasher>();
+}
+
+
+void ULowEntrySha256Hasher::Update(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	if (ByteArray.Num() <= 0)
+	{
+		return;
+	}
+
+	if (Index < 0)
+	{
+		Length += Index;
+		Index = 0;
+	}
+	if (Length > (ByteArray.Num() - Index))
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return;
+	}
+
+	Hasher.Update(ByteArray.GetData() + Index, Length);
+}
+
+void ULowEntrySha256Hasher::UpdateRope(ULowEntryByteRope* Rope)
+{
+	if (Rope == nullptr)
+	{
+		return;
+	}
+	Rope->Chain.ForEachFragment([this](const TArrayView<const uint8>& Fragment)
+	{
+		Hasher.Update(Fragment.GetData(), Fragment.Num());
+	});
+}
+
+TArray<uint8> ULowEntrySha256Hasher::Final()
+{
+	return Hasher.Final();
+}
+
+void ULowEntrySha256Hasher::Reset()
+{
+	Hasher.Reset();
+}
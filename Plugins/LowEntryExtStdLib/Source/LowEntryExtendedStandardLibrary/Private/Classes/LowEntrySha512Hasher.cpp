@@ -0,0 +1,59 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntrySha512Hasher.h"
+#include "LowEntryByteRope.h"
+
+
+ULowEntrySha512Hasher::ULowEntrySha512Hasher(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntrySha512Hasher* ULowEntrySha512Hasher::Create()
+{
+	return NewObject<ULowEntrySha512Hasher>();
+}
+
+
+void ULowEntrySha512Hasher::Update(const TArray<uint8>& ByteArray, int32 Index, int32 Length)
+{
+	if (ByteArray.Num() <= 0)
+	{
+		return;
+	}
+
+	if (Index < 0)
+	{
+		Length += Index;
+		Index = 0;
+	}
+	if (Length > (ByteArray.Num() - Index))
+	{
+		Length = ByteArray.Num() - Index;
+	}
+	if (Length <= 0)
+	{
+		return;
+	}
+
+	Hasher.Update(ByteArray.GetData() + Index, Length);
+}
+
+void ULowEntrySha512Hasher::UpdateRope(ULowEntryByteRope* Rope)
+{
+	if (Rope == nullptr)
+	{
+		return;
+	}
+	Rope->Chain.ForEachFragment([this](const TArrayView<const uint8>& Fragment)
+	{
+		Hasher.Update(Fragment.GetData(), Fragment.Num());
+	});
+}
+
+TArray<uint8> ULowEntrySha512Hasher::Final()
+{
+	return Hasher.Final();
+}
+
+void ULowEntrySha512Hasher::Reset()
+{
+	Hasher.Reset();
+}
@@ -0,0 +1,17 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntrySortLibrary.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+
+
+int32 ULowEntrySortLibrary::GetPartCount(const int32 Num)
+{
+	if ((Num < PARALLEL_SORT_MIN_COUNT) || !FApp::ShouldUseThreadingForPerformance())
+	{
+		return 1;
+	}
+	const int32 Workers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	return FMath::Clamp(Num / (PARALLEL_SORT_MIN_COUNT / 2), 1, Workers);
+}
@@ -0,0 +1,65 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "LowEntryTexturePool.h"
+
+
+ULowEntryTexturePool::ULowEntryTexturePool(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+ULowEntryTexturePool* ULowEntryTexturePool::Create(const int32 MaxTexturesPerSize)
+{
+	ULowEntryTexturePool* Instance = NewObject<ULowEntryTexturePool>();
+	Instance->MaxTexturesPerSize = FMath::Max(1, MaxTexturesPerSize);
+	return Instance;
+}
+
+
+UTexture2D* ULowEntryTexturePool::Take(const int32 Width, const int32 Height)
+{
+	for (int32 i = Textures.Num() - 1; i >= 0; i--)
+	{
+		UTexture2D* Texture2D = Textures[i];
+		if (!IsValid(Texture2D))
+		{
+			Textures.RemoveAtSwap(i);
+			continue;
+		}
+		if ((Texture2D->GetSizeX() == Width) && (Texture2D->GetSizeY() == Height) && (Texture2D->GetPixelFormat() == PF_B8G8R8A8))
+		{
+			Textures.RemoveAtSwap(i);
+			return Texture2D;
+		}
+	}
+	return nullptr;
+}
+
+void ULowEntryTexturePool::GiveBack(UTexture2D* Texture2D)
+{
+	if (!IsValid(Texture2D) || Textures.Contains(Texture2D))
+	{
+		return;
+	}
+
+	int32 SameSize = 0;
+	for (UTexture2D* Pooled : Textures)
+	{
+		if (IsValid(Pooled) && (Pooled->GetSizeX() == Texture2D->GetSizeX()) && (Pooled->GetSizeY() == Texture2D->GetSizeY()))
+		{
+			SameSize++;
+		}
+	}
+	if (SameSize >= MaxTexturesPerSize)
+	{
+		return;
+	}
+	Textures.Add(Texture2D);
+}
+
+int32 ULowEntryTexturePool::GetCount()
+{
+	return Textures.Num();
+}
+
+void ULowEntryTexturePool::Clear()
+{
+	Textures.Empty();
+}
@@ -0,0 +1,1103 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryBitReader.h"
+
+#include "Misc/ByteSwap.h"
+
+
+constexpr uint8 FLowEntryBitReader::mask[9] = {static_cast<uint8>(0x00), static_cast<uint8>(0x01), static_cast<uint8>(0x03), static_cast<uint8>(0x07), static_cast<uint8>(0x0F), static_cast<uint8>(0x1F), static_cast<uint8>(0x3F), static_cast<uint8>(0x7F), static_cast<uint8>(0xFF)};
+
+
+FLowEntryBitReader::FLowEntryBitReader(const TArrayView<const uint8>& Bytes0)
+	: Bytes(Bytes0) {}
+
+
+int32 FLowEntryBitReader::GetAndIncreasePosition(const int32 Increasement)
+{
+	int32 Pos = Position;
+	if ((Bytes.Num() - Increasement) <= Position)
+	{
+		Position = Bytes.Num();
+	}
+	else
+	{
+		Position += Increasement;
+	}
+	return Pos;
+}
+
+int32 FLowEntryBitReader::MaxElementsRemaining(const int32 MinimumSizePerElement) const
+{
+	int32 RemainingCount = Remaining();
+	if (RemainingCount <= 0)
+	{
+		return 0;
+	}
+	if (MinimumSizePerElement <= 1)
+	{
+		return RemainingCount;
+	}
+	return (RemainingCount / MinimumSizePerElement) + 1;
+}
+
+
+int32 FLowEntryBitReader::GetPosition() const
+{
+	return (Position * 8) + CurrentBytePosition;
+}
+
+void FLowEntryBitReader::SetPosition(const int32 Position_)
+{
+	if (Position_ < 0)
+	{
+		Reset();
+	}
+	else
+	{
+		Position = Position_ / 8;
+		CurrentBytePosition = Position_ % 8;
+		CurrentByte = 0;
+		if (Position > Bytes.Num())
+		{
+			Position = Bytes.Num();
+			CurrentBytePosition = 0;
+		}
+		else if (CurrentBytePosition > 0)
+		{
+			if (Position == 0)
+			{
+				CurrentBytePosition = 0;
+			}
+			else
+			{
+				CurrentByte = Bytes[Position - 1];
+			}
+		}
+	}
+}
+
+void FLowEntryBitReader::Reset()
+{
+	Position = 0;
+	CurrentBytePosition = 0;
+	CurrentByte = 0;
+}
+
+void FLowEntryBitReader::Empty()
+{
+	Position = Bytes.Num();
+	CurrentBytePosition = 0;
+	CurrentByte = 0;
+}
+
+int32 FLowEntryBitReader::Remaining() const
+{
+	if (CurrentBytePosition != 0)
+	{
+		return (Bytes.Num() - Position) + 1;
+	}
+	return Bytes.Num() - Position;
+}
+
+
+int64 FLowEntryBitReader::GetBitIndex() const
+{
+	if (CurrentBytePosition == 0)
+	{
+		return static_cast<int64>(Position) * 8;
+	}
+	return (static_cast<int64>(Position - 1) * 8) + CurrentBytePosition;
+}
+
+bool FLowEntryBitReader::HasBits(const int32 Count) const
+{
+	return (GetBitIndex() + Count) <= (static_cast<int64>(Bytes.Num()) * 8);
+}
+
+uint32 FLowEntryBitReader::ReadBits(const int32 Count)
+{
+	const int64 BitIndex = GetBitIndex();
+	const int32 ByteIndex = static_cast<int32>(BitIndex / 8);
+	const int32 Shift = static_cast<int32>(BitIndex % 8);
+
+	uint64 Word = 0;
+	FMemory::Memcpy(&Word, Bytes.GetData() + ByteIndex, FMath::Min(8, Bytes.Num() - ByteIndex));
+#if !PLATFORM_LITTLE_ENDIAN
+	Word = BYTESWAP_ORDER64(Word);
+#endif
+	Word >>= Shift;
+	const uint32 Value = (Count >= 32) ? static_cast<uint32>(Word) : (static_cast<uint32>(Word) & ((static_cast<uint32>(1) << Count) - 1));
+
+	const int64 NewBitIndex = BitIndex + Count;
+	CurrentBytePosition = static_cast<int32>(NewBitIndex % 8);
+	if (CurrentBytePosition == 0)
+	{
+		Position = static_cast<int32>(NewBitIndex / 8);
+	}
+	else
+	{
+		Position = static_cast<int32>(NewBitIndex / 8) + 1;
+		CurrentByte = Bytes[Position - 1];
+	}
+	return Value;
+}
+
+void FLowEntryBitReader::ReadBools(bool* Dest, const int32 Count)
+{
+	int32 i = 0;
+	for (; ((i + 32) <= Count) && HasBits(32); i += 32)
+	{
+		const uint32 Word = ReadBits(32);
+		for (int32 b = 0; b < 32; b++)
+		{
+			Dest[i + b] = (((Word >> b) & 1) != 0);
+		}
+	}
+	for (; i < Count; i++)
+	{
+		Dest[i] = GetRawBit();
+	}
+}
+
+uint64 FLowEntryBitReader::ReadVarint(const int32 MaxSize)
+{
+	uint64 Value = 0;
+	for (int32 i = 0; i < MaxSize; i++)
+	{
+		if (!HasBits(8))
+		{
+			Empty();
+			return 0;
+		}
+		const uint8 B = static_cast<uint8>(ReadBits(8));
+		Value |= static_cast<uint64>(B & 0x7f) << (7 * i);
+		if ((B & 0x80) == 0)
+		{
+			return Value;
+		}
+	}
+	return 0;
+}
+
+
+bool FLowEntryBitReader::GetRawBit()
+{
+	if (HasBits(1))
+	{
+		return (ReadBits(1) != 0);
+	}
+
+	if (CurrentBytePosition == 0)
+	{
+		int32 pos = GetAndIncreasePosition(1);
+		if (Bytes.Num() <= pos)
+		{
+			return false;
+		}
+		CurrentByte = Bytes[pos];
+	}
+
+	bool bit = (((CurrentByte >> CurrentBytePosition) & 1) != 0);
+
+	if (CurrentBytePosition == 7)
+	{
+		CurrentBytePosition = 0;
+	}
+	else
+	{
+		CurrentBytePosition++;
+	}
+
+	return bit;
+}
+
+uint8 FLowEntryBitReader::GetRawByte()
+{
+	if (HasBits(8))
+	{
+		return static_cast<uint8>(ReadBits(8));
+	}
+
+	if (CurrentBytePosition == 0)
+	{
+		int32 pos = GetAndIncreasePosition(1);
+		if (Bytes.Num() <= pos)
+		{
+			return 0;
+		}
+		return Bytes[pos];
+	}
+	uint8 b = ((CurrentByte >> CurrentBytePosition) & mask[8 - CurrentBytePosition]);
+
+	int32 pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= pos)
+	{
+		CurrentBytePosition = 0;
+		return b;
+	}
+	CurrentByte = Bytes[pos];
+
+	return (b | (CurrentByte << (8 - CurrentBytePosition)));
+}
+
+uint8 FLowEntryBitReader::GetPartialRawByte(int32 Bits)
+{
+	if (Bits == 0)
+	{
+		return 0;
+	}
+	if ((Bits >= 8) || (Bits <= -8))
+	{
+		return GetRawByte();
+	}
+
+	bool mostSignificantBits = false;
+	if (Bits < 0)
+	{
+		Bits = -Bits;
+		mostSignificantBits = true;
+	}
+
+	if (HasBits(Bits))
+	{
+		const uint8 b = static_cast<uint8>(ReadBits(Bits));
+		if (mostSignificantBits)
+		{
+			return (b << (8 - Bits));
+		}
+		return b;
+	}
+
+	if (CurrentBytePosition == 0)
+	{
+		int32 pos = GetAndIncreasePosition(1);
+		if (Bytes.Num() <= pos)
+		{
+			return 0;
+		}
+		CurrentByte = Bytes[pos];
+	}
+
+	uint8 b = ((CurrentByte >> CurrentBytePosition) & mask[8 - CurrentBytePosition]);
+	CurrentBytePosition += Bits;
+
+	if (CurrentBytePosition == 8)
+	{
+		CurrentBytePosition = 0;
+	}
+	else if (CurrentBytePosition > 8)
+	{
+		int32 pos = GetAndIncreasePosition(1);
+		if (Bytes.Num() <= pos)
+		{
+			CurrentBytePosition = 0;
+			b = (b & mask[Bits]);
+			if (mostSignificantBits)
+			{
+				return (b << (8 - Bits));
+			}
+			return b;
+		}
+		CurrentByte = Bytes[pos];
+		CurrentBytePosition -= 8;
+
+		if (CurrentBytePosition != 0)
+		{
+			b = ((b | (CurrentByte << (Bits - CurrentBytePosition))) & mask[Bits]);
+			if (mostSignificantBits)
+			{
+				return (b << (8 - Bits));
+			}
+			return b;
+		}
+	}
+	b = (b & mask[Bits]);
+	if (mostSignificantBits)
+	{
+		return (b << (8 - Bits));
+	}
+	return b;
+}
+
+int32 FLowEntryBitReader::GetRawBytes(uint8* Dest, const int32 Count)
+{
+	const int32 Length = FMath::Min(Count, Remaining());
+	if (Length <= 0)
+	{
+		return 0;
+	}
+	if (CurrentBytePosition == 0)
+	{
+		FMemory::Memcpy(Dest, Bytes.GetData() + Position, Length);
+		Position += Length;
+		return Length;
+	}
+	int32 i = 0;
+	for (; ((i + 4) <= Length) && HasBits(32); i += 4)
+	{
+		const uint32 Word = ReadBits(32);
+		Dest[i] = static_cast<uint8>(Word);
+		Dest[i + 1] = static_cast<uint8>(Word >> 8);
+		Dest[i + 2] = static_cast<uint8>(Word >> 16);
+		Dest[i + 3] = static_cast<uint8>(Word >> 24);
+	}
+	for (; i < Length; i++)
+	{
+		Dest[i] = GetRawByte();
+	}
+	return Length;
+}
+
+
+bool FLowEntryBitReader::GetBit()
+{
+	return GetRawBit();
+}
+
+uint8 FLowEntryBitReader::GetByteLeastSignificantBits(const int32 BitCount)
+{
+	if (BitCount <= 0)
+	{
+		return 0;
+	}
+	return GetPartialRawByte(BitCount);
+}
+
+uint8 FLowEntryBitReader::GetByteMostSignificantBits(const int32 BitCount)
+{
+	if (BitCount <= 0)
+	{
+		return 0;
+	}
+	return GetPartialRawByte(-BitCount);
+}
+
+int32 FLowEntryBitReader::GetIntegerLeastSignificantBits(const int32 BitCount)
+{
+	if (BitCount <= 0)
+	{
+		return 0;
+	}
+	if (HasBits(FMath::Min(BitCount, 32)))
+	{
+		return static_cast<int32>(ReadBits(FMath::Min(BitCount, 32)));
+	}
+	if (BitCount >= 32)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		uint8 b4 = GetRawByte();
+		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
+	}
+	if (BitCount > 24)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		uint8 b4 = GetPartialRawByte(BitCount - 24);
+		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
+	}
+	if (BitCount > 16)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetPartialRawByte(BitCount - 16);
+		return (b3 << 16) | (b2 << 8) | b1;
+	}
+	if (BitCount > 8)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetPartialRawByte(BitCount - 8);
+		return (b2 << 8) | b1;
+	}
+	uint8 b1 = GetPartialRawByte(BitCount);
+	return b1;
+}
+
+int32 FLowEntryBitReader::GetIntegerMostSignificantBits(int32 BitCount)
+{
+	if (BitCount <= 0)
+	{
+		return 0;
+	}
+	if (BitCount >= 32)
+	{
+		if (HasBits(32))
+		{
+			return static_cast<int32>(ReadBits(32));
+		}
+	}
+	else if (HasBits(BitCount))
+	{
+		return static_cast<int32>(ReadBits(BitCount) << (32 - BitCount));
+	}
+	BitCount = -BitCount;
+	if (BitCount <= -32)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		uint8 b4 = GetRawByte();
+		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
+	}
+	if (BitCount < -24)
+	{
+		uint8 b1 = GetPartialRawByte(BitCount + 24);
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		uint8 b4 = GetRawByte();
+		return (b4 << 24) | (b3 << 16) | (b2 << 8) | b1;
+	}
+	if (BitCount < -16)
+	{
+		uint8 b1 = GetPartialRawByte(BitCount + 16);
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		return (b3 << 24) | (b2 << 16) | (b1 << 8);
+	}
+	if (BitCount < -8)
+	{
+		uint8 b1 = GetPartialRawByte(BitCount + 8);
+		uint8 b2 = GetRawByte();
+		return (b2 << 24) | (b1 << 16);
+	}
+	uint8 b1 = GetPartialRawByte(BitCount);
+	return (b1 << 24);
+}
+
+uint8 FLowEntryBitReader::GetByte()
+{
+	return GetRawByte();
+}
+
+int32 FLowEntryBitReader::GetInteger()
+{
+	if (HasBits(32))
+	{
+		return static_cast<int32>(BYTESWAP_ORDER32(ReadBits(32)));
+	}
+	int32 RemainingCount = Remaining();
+	if (RemainingCount >= 4)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		uint8 b4 = GetRawByte();
+		return (b1 << 24) | (b2 << 16) | (b3 << 8) | b4;
+	}
+	if (RemainingCount == 3)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		uint8 b3 = GetRawByte();
+		return (b1 << 16) | (b2 << 8) | b3;
+	}
+	if (RemainingCount == 2)
+	{
+		uint8 b1 = GetRawByte();
+		uint8 b2 = GetRawByte();
+		return (b1 << 8) | b2;
+	}
+	if (RemainingCount == 1)
+	{
+		return GetRawByte();
+	}
+	return 0;
+}
+
+int32 FLowEntryBitReader::GetUinteger()
+{
+	if (Remaining() < 1)
+	{
+		return 0;
+	}
+
+	uint8 b1 = GetRawByte();
+	if (((b1 >> 7) & 1) == 0)
+	{
+		return b1;
+	}
+
+	if (Remaining() < 3)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b2 = GetRawByte();
+	uint8 b3 = GetRawByte();
+	uint8 b4 = GetRawByte();
+
+	int32 Value = ((b1 & ~(1 << 7)) << 24) | (b2 << 16) | (b3 << 8) | b4;
+	if (Value < 128)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryBitReader::GetPositiveInteger1()
+{
+	if (Remaining() < 1)
+	{
+		return 0;
+	}
+
+	uint8 b1 = GetRawByte();
+	if (((b1 >> 7) & 1) == 0)
+	{
+		return b1;
+	}
+
+	if (Remaining() < 3)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b2 = GetRawByte();
+	uint8 b3 = GetRawByte();
+	uint8 b4 = GetRawByte();
+
+	int32 Value = ((b1 & ~(1 << 7)) << 24) | (b2 << 16) | (b3 << 8) | b4;
+	if (Value < 128)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryBitReader::GetPositiveInteger2()
+{
+	if (Remaining() < 2)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b1 = GetRawByte();
+	uint8 b2 = GetRawByte();
+	if (((b1 >> 7) & 1) == 0)
+	{
+		return (b1 << 8) | b2;
+	}
+
+	if (Remaining() < 2)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b3 = GetRawByte();
+	uint8 b4 = GetRawByte();
+
+	int32 Value = ((b1 & ~(1 << 7)) << 24) | (b2 << 16) | (b3 << 8) | b4;
+	if (Value < 32768)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryBitReader::GetPositiveInteger3()
+{
+	if (Remaining() < 3)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b1 = GetRawByte();
+	uint8 b2 = GetRawByte();
+	uint8 b3 = GetRawByte();
+	if (((b1 >> 7) & 1) == 0)
+	{
+		return (b1 << 16) | (b2 << 8) | b3;
+	}
+
+	if (Remaining() < 1)
+	{
+		Empty();
+		return 0;
+	}
+
+	uint8 b4 = GetRawByte();
+
+	int32 Value = ((b1 & ~(1 << 7)) << 24) | (b2 << 16) | (b3 << 8) | b4;
+	if (Value < 8388608)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int64 FLowEntryBitReader::GetLong()
+{
+	if (HasBits(64))
+	{
+		const uint64 High = BYTESWAP_ORDER32(ReadBits(32));
+		const uint64 Low = BYTESWAP_ORDER32(ReadBits(32));
+		return static_cast<int64>((High << 32) | Low);
+	}
+	int32 RemainingCount = Remaining();
+	if (RemainingCount >= 8)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		int64 b4 = GetRawByte();
+		int64 b5 = GetRawByte();
+		int64 b6 = GetRawByte();
+		int64 b7 = GetRawByte();
+		int64 b8 = GetRawByte();
+		return (b1 << 56) | (b2 << 48) | (b3 << 40) | (b4 << 32) | (b5 << 24) | (b6 << 16) | (b7 << 8) | b8;
+	}
+	if (RemainingCount >= 7)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		int64 b4 = GetRawByte();
+		int64 b5 = GetRawByte();
+		int64 b6 = GetRawByte();
+		int64 b7 = GetRawByte();
+		return (b1 << 48) | (b2 << 40) | (b3 << 32) | (b4 << 24) | (b5 << 16) | (b6 << 8) | b7;
+	}
+	if (RemainingCount >= 6)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		int64 b4 = GetRawByte();
+		int64 b5 = GetRawByte();
+		int64 b6 = GetRawByte();
+		return (b1 << 40) | (b2 << 32) | (b3 << 24) | (b4 << 16) | (b5 << 8) | b6;
+	}
+	if (RemainingCount >= 5)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		int64 b4 = GetRawByte();
+		int64 b5 = GetRawByte();
+		return (b1 << 32) | (b2 << 24) | (b3 << 16) | (b4 << 8) | b5;
+	}
+	if (RemainingCount >= 4)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		int64 b4 = GetRawByte();
+		return (b1 << 24) | (b2 << 16) | (b3 << 8) | b4;
+	}
+	if (RemainingCount == 3)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		int64 b3 = GetRawByte();
+		return (b1 << 16) | (b2 << 8) | b3;
+	}
+	if (RemainingCount == 2)
+	{
+		int64 b1 = GetRawByte();
+		int64 b2 = GetRawByte();
+		return (b1 << 8) | b2;
+	}
+	if (RemainingCount == 1)
+	{
+		return GetRawByte();
+	}
+	return 0;
+}
+
+float FLowEntryBitReader::GetFloat()
+{
+	int32 IntValue = GetInteger();
+	return *reinterpret_cast<float*>(&IntValue);
+}
+
+double FLowEntryBitReader::GetDouble()
+{
+	int64 LongValue = GetLong();
+	return *reinterpret_cast<double*>(&LongValue);
+}
+
+bool FLowEntryBitReader::GetBoolean()
+{
+	return GetRawBit();
+}
+
+FString FLowEntryBitReader::GetStringUtf8()
+{
+	int32 length = GetUinteger();
+	length = FMath::Min(length, MaxElementsRemaining(1));
+	if (length <= 0)
+	{
+		return "";
+	}
+	if (CurrentBytePosition == 0)
+	{
+		int32 pos = GetAndIncreasePosition(length);
+		length = FMath::Min(length, Bytes.Num() - pos);
+		if (length <= 0)
+		{
+			return "";
+		}
+		const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + pos), length);
+		return FString(Src.Length(), Src.Get());
+	}
+	TArray<uint8> Data;
+	Data.SetNum(length);
+	GetRawBytes(Data.GetData(), length);
+	const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+	return FString(Src.Length(), Src.Get());
+}
+
+
+int32 FLowEntryBitReader::GetVarInteger()
+{
+	return static_cast<int32>(ReadVarint(FLowEntryVarint::MaxIntegerSize));
+}
+
+int64 FLowEntryBitReader::GetVarLong()
+{
+	return static_cast<int64>(ReadVarint(FLowEntryVarint::MaxLongSize));
+}
+
+int32 FLowEntryBitReader::GetZigZagInteger()
+{
+	return FLowEntryVarint::ZigZagDecode(static_cast<uint32>(ReadVarint(FLowEntryVarint::MaxIntegerSize)));
+}
+
+int64 FLowEntryBitReader::GetZigZagLong()
+{
+	return FLowEntryVarint::ZigZagDecode(ReadVarint(FLowEntryVarint::MaxLongSize));
+}
+
+TArray<bool> FLowEntryBitReader::GetBitArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, SafeMultiply(MaxElementsRemaining(1), 8));
+	if (Length <= 0)
+	{
+		return TArray<bool>();
+	}
+	TArray<bool> Array;
+	Array.SetNum(Length);
+	ReadBools(Array.GetData(), Length);
+	return Array;
+}
+
+TArray<uint8> FLowEntryBitReader::GetByteArrayLeastSignificantBits(const int32 BitCount)
+{
+	int32 Length = GetUinteger();
+	if (BitCount <= 0)
+	{
+		return TArray<uint8>();
+	}
+	Length = static_cast<int>(FMath::Min(static_cast<double>(Length), FMath::CeilToDouble(MaxElementsRemaining(1) * (8.0 / BitCount))));
+	if (Length <= 0)
+	{
+		return TArray<uint8>();
+	}
+	TArray<uint8> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetByteLeastSignificantBits(BitCount);
+	}
+	return Array;
+}
+
+TArray<uint8> FLowEntryBitReader::GetByteArrayMostSignificantBits(const int32 BitCount)
+{
+	int32 Length = GetUinteger();
+	if (BitCount <= 0)
+	{
+		return TArray<uint8>();
+	}
+	Length = static_cast<int>(FMath::Min(static_cast<double>(Length), FMath::CeilToDouble(MaxElementsRemaining(1) * (8.0 / BitCount))));
+	if (Length <= 0)
+	{
+		return TArray<uint8>();
+	}
+	TArray<uint8> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetByteMostSignificantBits(BitCount);
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetIntegerArrayLeastSignificantBits(const int32 BitCount)
+{
+	int32 Length = GetUinteger();
+	if (BitCount <= 0)
+	{
+		return TArray<int32>();
+	}
+	Length = static_cast<int>(FMath::Min(static_cast<double>(Length), FMath::CeilToDouble(MaxElementsRemaining(1) * (8.0 / BitCount))));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetIntegerLeastSignificantBits(BitCount);
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetIntegerArrayMostSignificantBits(const int32 BitCount)
+{
+	int32 Length = GetUinteger();
+	if (BitCount <= 0)
+	{
+		return TArray<int32>();
+	}
+	Length = static_cast<int>(FMath::Min(static_cast<double>(Length), FMath::CeilToDouble(MaxElementsRemaining(1) * (8.0 / BitCount))));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetIntegerMostSignificantBits(BitCount);
+	}
+	return Array;
+}
+
+TArray<uint8> FLowEntryBitReader::GetByteArray()
+{
+	int32 length = GetUinteger();
+	length = FMath::Min(length, MaxElementsRemaining(1));
+	if (length <= 0)
+	{
+		return TArray<uint8>();
+	}
+	if (CurrentBytePosition == 0)
+	{
+		int32 pos = GetAndIncreasePosition(length);
+		length = FMath::Min(length, Bytes.Num() - pos);
+		if (length <= 0)
+		{
+			return TArray<uint8>();
+		}
+		return TArray<uint8>(Bytes.GetData() + pos, length);
+	}
+	TArray<uint8> Data;
+	Data.SetNum(length);
+	GetRawBytes(Data.GetData(), length);
+	return Data;
+}
+
+TArray<int32> FLowEntryBitReader::GetIntegerArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(4));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetInteger();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetPositiveInteger1Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger1();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetPositiveInteger2Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(2));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger2();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetPositiveInteger3Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(3));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger3();
+	}
+	return Array;
+}
+
+TArray<int64> FLowEntryBitReader::GetLongArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<int64>();
+	}
+	TArray<int64> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetLong();
+	}
+	return Array;
+}
+
+TArray<float> FLowEntryBitReader::GetFloatArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(4));
+	if (Length <= 0)
+	{
+		return TArray<float>();
+	}
+	TArray<float> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetFloat();
+	}
+	return Array;
+}
+
+TArray<double> FLowEntryBitReader::GetDoubleArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<double>();
+	}
+	TArray<double> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetDouble();
+	}
+	return Array;
+}
+
+TArray<bool> FLowEntryBitReader::GetBooleanArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, SafeMultiply(MaxElementsRemaining(1), 8));
+	if (Length <= 0)
+	{
+		return TArray<bool>();
+	}
+	TArray<bool> Array;
+	Array.SetNum(Length);
+	ReadBools(Array.GetData(), Length);
+	return Array;
+}
+
+TArray<FString> FLowEntryBitReader::GetStringUtf8Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<FString>();
+	}
+	TArray<FString> Array;
+	Array.SetNumZeroed(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetStringUtf8();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryBitReader::GetIntegerArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNumUninitialized(Length);
+	uint32 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint32>(GetZigZagInteger());
+		Array[i] = static_cast<int32>(Previous);
+	}
+	return Array;
+}
+
+TArray<int64> FLowEntryBitReader::GetLongArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int64>();
+	}
+	TArray<int64> Array;
+	Array.SetNumUninitialized(Length);
+	uint64 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint64>(GetZigZagLong());
+		Array[i] = static_cast<int64>(Previous);
+	}
+	return Array;
+}
+
+
+int32 FLowEntryBitReader::SafeMultiply(const int32 A, const int32 B)
+{
+	int64 Result = static_cast<int64>(A) * static_cast<int64>(B);
+	int32 Max = 2147483647;
+	int32 Min = (-2147483647 - 1);
+	if (Result >= Max)
+	{
+		return Max;
+	}
+	if (Result <= Min)
+	{
+		return Min;
+	}
+	return static_cast<int32>(Result);
+}
@@ -0,0 +1,523 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryBitWriter.h"
+
+#include "Misc/ByteSwap.h"
+
+
+void FLowEntryBitWriter::AddBits(const uint32 Value, const int32 Count)
+{
+	const uint64 Masked = (Count >= 32) ? Value : (Value & ((static_cast<uint32>(1) << Count) - 1));
+	Accumulator |= (Masked << AccumulatorBits);
+	AccumulatorBits += Count;
+	if (AccumulatorBits >= 64)
+	{
+		FlushAccumulator();
+		AccumulatorBits -= 64;
+		Accumulator = (AccumulatorBits > 0) ? (Masked >> (Count - AccumulatorBits)) : 0;
+	}
+}
+
+void FLowEntryBitWriter::FlushAccumulator()
+{
+#if PLATFORM_LITTLE_ENDIAN
+	const uint64 LittleEndian = Accumulator;
+#else
+	const uint64 LittleEndian = BYTESWAP_ORDER64(Accumulator);
+#endif
+	const int32 Index = Bytes.AddUninitialized(8);
+	FMemory::Memcpy(Bytes.GetData() + Index, &LittleEndian, 8);
+}
+
+void FLowEntryBitWriter::AddBools(const TArrayView<const bool>& Value)
+{
+	const bool* Data = Value.GetData();
+	const int32 Num = Value.Num();
+	int32 i = 0;
+	for (; (i + 32) <= Num; i += 32)
+	{
+		uint32 Word = 0;
+		for (int32 b = 0; b < 32; b++)
+		{
+			Word |= (Data[i + b] ? 1u : 0u) << b;
+		}
+		AddBits(Word, 32);
+	}
+	for (; i < Num; i++)
+	{
+		AddBits(Data[i] ? 1 : 0, 1);
+	}
+}
+
+void FLowEntryBitWriter::AddVarint(const uint64 Value)
+{
+	uint8 Buffer[FLowEntryVarint::MaxLongSize];
+	AddRawBytes(TArrayView<const uint8>(Buffer, FLowEntryVarint::Write(Buffer, Value)));
+}
+
+void FLowEntryBitWriter::FlushWholeBytes()
+{
+	while (AccumulatorBits >= 8)
+	{
+		Bytes.Add(static_cast<uint8>(Accumulator));
+		Accumulator >>= 8;
+		AccumulatorBits -= 8;
+	}
+}
+
+
+void FLowEntryBitWriter::AddRawBit(const bool Value)
+{
+	AddBits(Value ? 1 : 0, 1);
+}
+
+void FLowEntryBitWriter::AddRawByte(const uint8 Value)
+{
+	AddBits(Value, 8);
+}
+
+void FLowEntryBitWriter::AddPartialRawByte(uint8 Value, int32 Bits)
+{
+	if (Bits == 0)
+	{
+		return;
+	}
+	if ((Bits >= 8) || (Bits <= -8))
+	{
+		AddRawByte(Value);
+		return;
+	}
+
+	if (Bits < 0)
+	{
+		Bits = -Bits;
+		Value >>= (8 - Bits);
+	}
+
+	AddBits(Value, Bits);
+}
+
+void FLowEntryBitWriter::AddRawBytes(const TArrayView<const uint8>& Value)
+{
+	const uint8* Data = Value.GetData();
+	const int32 Num = Value.Num();
+	if ((AccumulatorBits & 7) == 0)
+	{
+		FlushWholeBytes();
+		Bytes.Append(Data, Num);
+		return;
+	}
+
+	int32 i = 0;
+	for (; (i + 4) <= Num; i += 4)
+	{
+		AddBits(static_cast<uint32>(Data[i]) | (static_cast<uint32>(Data[i + 1]) << 8) | (static_cast<uint32>(Data[i + 2]) << 16) | (static_cast<uint32>(Data[i + 3]) << 24), 32);
+	}
+	for (; i < Num; i++)
+	{
+		AddBits(Data[i], 8);
+	}
+}
+
+
+TArray<uint8> FLowEntryBitWriter::GetBytes() const
+{
+	const int32 PendingBytes = (AccumulatorBits + 7) / 8;
+	TArray<uint8> Data;
+	Data.Reserve(Bytes.Num() + PendingBytes);
+	Data.Append(Bytes);
+	uint64 Pending = Accumulator;
+	for (int32 i = 0; i < PendingBytes; i++)
+	{
+		Data.Add(static_cast<uint8>(Pending));
+		Pending >>= 8;
+	}
+	return Data;
+}
+
+void FLowEntryBitWriter::Reset()
+{
+	Bytes.Reset();
+	Accumulator = 0;
+	AccumulatorBits = 0;
+}
+
+
+void FLowEntryBitWriter::AddBit(const bool Value)
+{
+	AddBits(Value ? 1 : 0, 1);
+}
+void FLowEntryBitWriter::AddByteLeastSignificantBits(const uint8 Value, const int32 BitCount)
+{
+	if (BitCount > 0)
+	{
+		AddBits(Value, FMath::Min(BitCount, 8));
+	}
+}
+void FLowEntryBitWriter::AddByteMostSignificantBits(const uint8 Value, const int32 BitCount)
+{
+	if (BitCount > 0)
+	{
+		AddPartialRawByte(Value, -BitCount);
+	}
+}
+void FLowEntryBitWriter::AddIntegerLeastSignificantBits(const int32 Value, const int32 BitCount)
+{
+	if (BitCount > 0)
+	{
+		AddBits(static_cast<uint32>(Value), FMath::Min(BitCount, 32));
+	}
+}
+void FLowEntryBitWriter::AddIntegerMostSignificantBits(const int32 Value, int32 BitCount)
+{
+	if (BitCount > 0)
+	{
+		if (BitCount >= 32)
+		{
+			AddBits(static_cast<uint32>(Value), 32);
+		}
+		else
+		{
+			AddBits(static_cast<uint32>(Value) >> (32 - BitCount), BitCount);
+		}
+	}
+}
+void FLowEntryBitWriter::AddByte(const uint8 Value)
+{
+	AddBits(Value, 8);
+}
+void FLowEntryBitWriter::AddInteger(const int32 Value)
+{
+	AddBits(BYTESWAP_ORDER32(static_cast<uint32>(Value)), 32);
+}
+void FLowEntryBitWriter::AddUinteger(const int32 Value)
+{
+	if (Value <= 0)
+	{
+		AddBits(0, 8);
+	}
+	else if (Value < 128)
+	{
+		AddBits(Value, 8);
+	}
+	else
+	{
+		AddInteger(Value | static_cast<int32>(0x80000000));
+	}
+}
+void FLowEntryBitWriter::AddPositiveInteger1(const int32 Value)
+{
+	AddUinteger(Value);
+}
+void FLowEntryBitWriter::AddPositiveInteger2(const int32 Value)
+{
+	if (Value <= 0)
+	{
+		AddBits(0, 16);
+	}
+	else if (Value < 32768)
+	{
+		AddBits(BYTESWAP_ORDER16(static_cast<uint16>(Value)), 16);
+	}
+	else
+	{
+		AddInteger(Value | static_cast<int32>(0x80000000));
+	}
+}
+void FLowEntryBitWriter::AddPositiveInteger3(const int32 Value)
+{
+	if (Value <= 0)
+	{
+		AddBits(0, 24);
+	}
+	else if (Value < 8388608)
+	{
+		AddBits(BYTESWAP_ORDER32(static_cast<uint32>(Value)) >> 8, 24);
+	}
+	else
+	{
+		AddInteger(Value | static_cast<int32>(0x80000000));
+	}
+}
+void FLowEntryBitWriter::AddLong(const int64 Value)
+{
+	AddInteger(static_cast<int32>(Value >> 32));
+	AddInteger(static_cast<int32>(Value));
+}
+void FLowEntryBitWriter::AddFloat(const float Value)
+{
+	int32 IntValue;
+	FMemory::Memcpy(&IntValue, &Value, 4);
+	AddInteger(IntValue);
+}
+void FLowEntryBitWriter::AddDouble(const double Value)
+{
+	int64 LongValue;
+	FMemory::Memcpy(&LongValue, &Value, 8);
+	AddLong(LongValue);
+}
+void FLowEntryBitWriter::AddBoolean(const bool Value)
+{
+	AddRawBit(Value);
+}
+void FLowEntryBitWriter::AddStringUtf8(const FString& Value)
+{
+	if (Value.Len() <= 0)
+	{
+		AddUinteger(0);
+		return;
+	}
+	const FTCHARToUTF8 Src = FTCHARToUTF8(Value.GetCharArray().GetData());
+	AddByteArray(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Src.Get()), Src.Length()));
+}
+void FLowEntryBitWriter::AddVarInteger(const int32 Value)
+{
+	AddVarint(static_cast<uint32>(Value));
+}
+void FLowEntryBitWriter::AddVarLong(const int64 Value)
+{
+	AddVarint(static_cast<uint64>(Value));
+}
+void FLowEntryBitWriter::AddZigZagInteger(const int32 Value)
+{
+	AddVarint(FLowEntryVarint::ZigZagEncode(Value));
+}
+void FLowEntryBitWriter::AddZigZagLong(const int64 Value)
+{
+	AddVarint(FLowEntryVarint::ZigZagEncode(Value));
+}
+
+
+void FLowEntryBitWriter::AddBitArray(const TArrayView<const bool>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	AddBools(Value);
+}
+void FLowEntryBitWriter::AddByteArrayLeastSignificantBits(const TArrayView<const uint8>& Value, const int32 BitCount)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (uint8 V : Value)
+	{
+		AddByteLeastSignificantBits(V, BitCount);
+	}
+}
+void FLowEntryBitWriter::AddByteArrayMostSignificantBits(const TArrayView<const uint8>& Value, const int32 BitCount)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (uint8 V : Value)
+	{
+		AddByteMostSignificantBits(V, BitCount);
+	}
+}
+void FLowEntryBitWriter::AddIntegerArrayLeastSignificantBits(const TArrayView<const int32>& Value, const int32 BitCount)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddIntegerLeastSignificantBits(V, BitCount);
+	}
+}
+void FLowEntryBitWriter::AddIntegerArrayMostSignificantBits(const TArrayView<const int32>& Value, const int32 BitCount)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddIntegerMostSignificantBits(V, BitCount);
+	}
+}
+void FLowEntryBitWriter::AddByteArray(const TArrayView<const uint8>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	AddRawBytes(Value);
+}
+void FLowEntryBitWriter::AddIntegerArray(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddInteger(V);
+	}
+}
+void FLowEntryBitWriter::AddPositiveInteger1Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddPositiveInteger1(V);
+	}
+}
+void FLowEntryBitWriter::AddPositiveInteger2Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddPositiveInteger2(V);
+	}
+}
+void FLowEntryBitWriter::AddPositiveInteger3Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int32 V : Value)
+	{
+		AddPositiveInteger3(V);
+	}
+}
+void FLowEntryBitWriter::AddLongArray(const TArrayView<const int64>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (int64 V : Value)
+	{
+		AddLong(V);
+	}
+}
+void FLowEntryBitWriter::AddFloatArray(const TArrayView<const float>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (float V : Value)
+	{
+		AddFloat(V);
+	}
+}
+void FLowEntryBitWriter::AddDoubleArray(const TArrayView<const double>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (double V : Value)
+	{
+		AddDouble(V);
+	}
+}
+void FLowEntryBitWriter::AddBooleanArray(const TArrayView<const bool>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	AddBools(Value);
+}
+void FLowEntryBitWriter::AddStringUtf8Array(const TArrayView<const FString>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (const FString& V : Value)
+	{
+		AddStringUtf8(V);
+	}
+}
+void FLowEntryBitWriter::AddIntegerArrayDelta(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	int32 Previous = 0;
+	for (int32 V : Value)
+	{
+		AddZigZagInteger(static_cast<int32>(static_cast<uint32>(V) - static_cast<uint32>(Previous)));
+		Previous = V;
+	}
+}
+void FLowEntryBitWriter::AddLongArrayDelta(const TArrayView<const int64>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	int64 Previous = 0;
+	for (int64 V : Value)
+	{
+		AddZigZagLong(static_cast<int64>(static_cast<uint64>(V) - static_cast<uint64>(Previous)));
+		Previous = V;
+	}
+}
@@ -0,0 +1,204 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteChain.h"
+
+
+FLowEntryByteChain::FLowEntryByteChain(TArray<uint8>&& Bytes)
+{
+	Append(MoveTemp(Bytes));
+}
+
+
+int64 FLowEntryByteChain::Num() const
+{
+	return Length;
+}
+
+bool FLowEntryByteChain::IsEmpty() const
+{
+	return (Length <= 0);
+}
+
+int32 FLowEntryByteChain::GetFragmentCount() const
+{
+	return Fragments.Num();
+}
+
+const FLowEntryByteChain::FFragment& FLowEntryByteChain::GetFragment(const int32 Index) const
+{
+	return Fragments[Index];
+}
+
+void FLowEntryByteChain::Reset()
+{
+	Fragments.Reset();
+	Length = 0;
+}
+
+
+void FLowEntryByteChain::AddFragment(const FBytesRef& Bytes, const int32 Offset, const int32 Count, const bool AtStart)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+	if (AtStart)
+	{
+		Fragments.Insert(FFragment{Bytes, Offset, Count}, 0);
+	}
+	else
+	{
+		Fragments.Add(FFragment{Bytes, Offset, Count});
+	}
+	Length += Count;
+}
+
+
+void FLowEntryByteChain::Append(TArray<uint8>&& Bytes)
+{
+	const int32 Count = Bytes.Num();
+	if (Count > 0)
+	{
+		AddFragment(MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Bytes)), 0, Count, false);
+	}
+}
+
+void FLowEntryByteChain::Append(const TArrayView<const uint8>& Bytes)
+{
+	if (Bytes.Num() > 0)
+	{
+		Append(TArray<uint8>(Bytes.GetData(), Bytes.Num()));
+	}
+}
+
+void FLowEntryByteChain::Append(const FBytesRef& Bytes, int32 Index, int32 Count)
+{
+	if (Index < 0)
+	{
+		Count += Index;
+		Index = 0;
+	}
+	if (Count > (Bytes->Num() - Index))
+	{
+		Count = Bytes->Num() - Index;
+	}
+	AddFragment(Bytes, Index, Count, false);
+}
+
+void FLowEntryByteChain::Append(const FLowEntryByteChain& Chain)
+{
+	if (&Chain == this)
+	{
+		const FLowEntryByteChain Copy = Chain;
+		Append(Copy);
+		return;
+	}
+	Fragments.Append(Chain.Fragments);
+	Length += Chain.Length;
+}
+
+
+void FLowEntryByteChain::Prepend(TArray<uint8>&& Bytes)
+{
+	const int32 Count = Bytes.Num();
+	if (Count > 0)
+	{
+		AddFragment(MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Bytes)), 0, Count, true);
+	}
+}
+
+void FLowEntryByteChain::Prepend(const TArrayView<const uint8>& Bytes)
+{
+	if (Bytes.Num() > 0)
+	{
+		Prepend(TArray<uint8>(Bytes.GetData(), Bytes.Num()));
+	}
+}
+
+void FLowEntryByteChain::Prepend(const FBytesRef& Bytes, int32 Index, int32 Count)
+{
+	if (Index < 0)
+	{
+		Count += Index;
+		Index = 0;
+	}
+	if (Count > (Bytes->Num() - Index))
+	{
+		Count = Bytes->Num() - Index;
+	}
+	AddFragment(Bytes, Index, Count, true);
+}
+
+void FLowEntryByteChain::Prepend(const FLowEntryByteChain& Chain)
+{
+	if (&Chain == this)
+	{
+		const FLowEntryByteChain Copy = Chain;
+		Prepend(Copy);
+		return;
+	}
+	Fragments.Insert(Chain.Fragments.GetData(), Chain.Fragments.Num(), 0);
+	Length += Chain.Length;
+}
+
+
+FLowEntryByteChain FLowEntryByteChain::Slice(int64 Index, int64 Count) const
+{
+	if (Index < 0)
+	{
+		Count += Index;
+		Index = 0;
+	}
+	if (Count > (Length - Index))
+	{
+		Count = Length - Index;
+	}
+
+	FLowEntryByteChain Result;
+	for (const FFragment& Fragment : Fragments)
+	{
+		if (Count <= 0)
+		{
+			break;
+		}
+		if (Index >= Fragment.Length)
+		{
+			Index -= Fragment.Length;
+			continue;
+		}
+		const int32 Take = static_cast<int32>(FMath::Min<int64>(Fragment.Length - Index, Count));
+		Result.AddFragment(Fragment.Bytes, Fragment.Offset + static_cast<int32>(Index), Take, false);
+		Count -= Take;
+		Index = 0;
+	}
+	return Result;
+}
+
+void FLowEntryByteChain::CopyTo(uint8* Dest) const
+{
+	for (const FFragment& Fragment : Fragments)
+	{
+		FMemory::Memcpy(Dest, Fragment.Bytes->GetData() + Fragment.Offset, Fragment.Length);
+		Dest += Fragment.Length;
+	}
+}
+
+TArray<uint8> FLowEntryByteChain::Flatten() const
+{
+	if ((Length <= 0) || (Length > 0x7FFFFFFF))
+	{
+		return TArray<uint8>();
+	}
+	TArray<uint8> Result;
+	Result.SetNumUninitialized(static_cast<int32>(Length));
+	CopyTo(Result.GetData());
+	return Result;
+}
+
+void FLowEntryByteChain::ForEachFragment(const TFunctionRef<void(const TArrayView<const uint8>&)>& Function) const
+{
+	for (const FFragment& Fragment : Fragments)
+	{
+		Function(Fragment.GetView());
+	}
+}
@@ -0,0 +1,363 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteCompression.h"
+
+#include "Misc/Compression.h"
+
+
+namespace LowEntryByteCompression
+{
+	void WriteInteger(uint8* Dest, const int32 Value)
+	{
+		Dest[0] = static_cast<uint8>(Value >> 24);
+		Dest[1] = static_cast<uint8>(Value >> 16);
+		Dest[2] = static_cast<uint8>(Value >> 8);
+		Dest[3] = static_cast<uint8>(Value);
+	}
+
+	int32 ReadInteger(const uint8* Src)
+	{
+		return static_cast<int32>((static_cast<uint32>(Src[0]) << 24) | (static_cast<uint32>(Src[1]) << 16) | (static_cast<uint32>(Src[2]) << 8) | static_cast<uint32>(Src[3]));
+	}
+}
+
+
+uint8 FLowEntryByteCompression::GetCodec(const FName& Format)
+{
+	if (Format == NAME_Oodle)
+	{
+		return CodecOodle;
+	}
+	if (Format == NAME_Zlib)
+	{
+		return CodecZlib;
+	}
+	if (Format == NAME_Gzip)
+	{
+		return CodecGzip;
+	}
+	if (Format == NAME_LZ4)
+	{
+		return CodecLZ4;
+	}
+	return CodecRaw;
+}
+
+FName FLowEntryByteCompression::GetFormat(const uint8 Codec)
+{
+	switch (Codec)
+	{
+	case CodecZlib:
+		return NAME_Zlib;
+	case CodecGzip:
+		return NAME_Gzip;
+	case CodecLZ4:
+		return NAME_LZ4;
+	case CodecOodle:
+		return NAME_Oodle;
+	default:
+		return NAME_None;
+	}
+}
+
+
+void FLowEntryByteCompression::EncodeFrame(const TArrayView<const uint8>& Bytes, TArray<uint8>& Out, const FName& Format, const int32 RawThreshold)
+{
+	if (Bytes.Num() > MaxFrameSize)
+	{
+		Compress(Bytes, Out, Format, MaxFrameSize, RawThreshold);
+		return;
+	}
+
+	const int32 HeaderStart = Out.AddUninitialized(HeaderSize);
+	uint8 Codec = CodecRaw;
+	int32 PayloadSize = Bytes.Num();
+
+	const uint8 RequestedCodec = GetCodec(Format);
+	if ((RequestedCodec != CodecRaw) && (Bytes.Num() >= RawThreshold))
+	{
+		// compresses directly into Out, falls back to storing the bytes raw if that doesn't make them any smaller
+		int32 CompressedSize = FCompression::CompressMemoryBound(Format, Bytes.Num());
+		Out.AddUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(Format, Out.GetData() + HeaderStart + HeaderSize, CompressedSize, Bytes.GetData(), Bytes.Num()) && (CompressedSize < Bytes.Num()))
+		{
+			if ((static_cast<int64>(CompressedSize) * MaxCompressionRatio) >= Bytes.Num())
+			{
+				Codec = RequestedCodec;
+				PayloadSize = CompressedSize;
+			}
+			else if (Bytes.Num() > MaxCompressionRatio)
+			{
+				// compresses too well to pass ReadHeader, so it's split in halves, which will compress less well
+				Out.SetNum(HeaderStart, EAllowShrinking::No);
+				const int32 Half = Bytes.Num() / 2;
+				EncodeFrame(Bytes.Slice(0, Half), Out, Format, RawThreshold);
+				EncodeFrame(Bytes.Slice(Half, Bytes.Num() - Half), Out, Format, RawThreshold);
+				return;
+			}
+		}
+		Out.SetNum(HeaderStart + HeaderSize + ((Codec == CodecRaw) ? 0 : PayloadSize), EAllowShrinking::No);
+	}
+	if (Codec == CodecRaw)
+	{
+		Out.Append(Bytes.GetData(), Bytes.Num());
+	}
+
+	uint8* Header = Out.GetData() + HeaderStart;
+	Header[0] = Codec;
+	LowEntryByteCompression::WriteInteger(Header + 1, Bytes.Num());
+	LowEntryByteCompression::WriteInteger(Header + 5, PayloadSize);
+}
+
+bool FLowEntryByteCompression::ReadHeader(const uint8* Src, FFrameHeader& Header)
+{
+	Header.Codec = Src[0];
+	Header.RawSize = LowEntryByteCompression::ReadInteger(Src + 1);
+	Header.PayloadSize = LowEntryByteCompression::ReadInteger(Src + 5);
+	if ((Header.Codec > CodecOodle) || (Header.RawSize < 0) || (Header.RawSize > MaxFrameSize) || (Header.PayloadSize < 0))
+	{
+		return false;
+	}
+	if (Header.Codec == CodecRaw)
+	{
+		return (Header.RawSize == Header.PayloadSize);
+	}
+	// a payload that is too small for the claimed size (an empty one for example) is rejected before anything is allocated for it
+	return ((static_cast<int64>(Header.PayloadSize) * MaxCompressionRatio) >= Header.RawSize);
+}
+
+bool FLowEntryByteCompression::DecodePayload(const FFrameHeader& Header, const uint8* Payload, uint8* Dest)
+{
+	if (Header.RawSize <= 0)
+	{
+		return true;
+	}
+	if (Header.Codec == CodecRaw)
+	{
+		FMemory::Memcpy(Dest, Payload, Header.RawSize);
+		return true;
+	}
+	return FCompression::UncompressMemory(GetFormat(Header.Codec), Dest, Header.RawSize, Payload, Header.PayloadSize);
+}
+
+
+void FLowEntryByteCompression::Compress(const TArrayView<const uint8>& Bytes, TArray<uint8>& Out, const FName& Format, const int32 FrameSize, const int32 RawThreshold)
+{
+	const int32 Size = FMath::Clamp(FrameSize, 64, MaxFrameSize);
+	for (int32 Start = 0; Start < Bytes.Num(); Start += Size)
+	{
+		EncodeFrame(Bytes.Slice(Start, FMath::Min(Size, Bytes.Num() - Start)), Out, Format, RawThreshold);
+	}
+}
+
+bool FLowEntryByteCompression::Decompress(const TArrayView<const uint8>& Frames, TArray<uint8>& Out)
+{
+	// the headers are checked first, so that the output can be allocated once and each frame can be decompressed directly into it
+	int64 RawSize = 0;
+	int32 Offset = 0;
+	FFrameHeader Header;
+	while (Offset < Frames.Num())
+	{
+		if (((Frames.Num() - Offset) < HeaderSize) || !ReadHeader(Frames.GetData() + Offset, Header) || (Header.PayloadSize > (Frames.Num() - Offset - HeaderSize)))
+		{
+			return false;
+		}
+		RawSize += Header.RawSize;
+		Offset += HeaderSize + Header.PayloadSize;
+	}
+	if ((Out.Num() + RawSize) > MAX_int32)
+	{
+		return false;
+	}
+
+	int32 Dest = Out.Num();
+	Out.AddUninitialized(static_cast<int32>(RawSize));
+	Offset = 0;
+	while (Offset < Frames.Num())
+	{
+		ReadHeader(Frames.GetData() + Offset, Header);
+		if (!DecodePayload(Header, Frames.GetData() + Offset + HeaderSize, Out.GetData() + Dest))
+		{
+			Out.SetNum(Out.Num() - static_cast<int32>(RawSize), EAllowShrinking::No);
+			return false;
+		}
+		Dest += Header.RawSize;
+		Offset += HeaderSize + Header.PayloadSize;
+	}
+	return true;
+}
+
+
+FLowEntryByteCompressionSink::FLowEntryByteCompressionSink(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Inner0, const FName& Format0, const int32 RawThreshold0)
+	: Inner(Inner0)
+	, Format(Format0)
+	, RawThreshold(RawThreshold0) {}
+
+void FLowEntryByteCompressionSink::Write(TArray<uint8>& Chunk)
+{
+	if (Chunk.Num() > 0)
+	{
+		Frame.Reset();
+		FLowEntryByteCompression::EncodeFrame(Chunk, Frame, Format, RawThreshold);
+		Inner->Write(Frame);
+	}
+	Chunk.Reset();
+}
+
+bool FLowEntryByteCompressionSink::Flush()
+{
+	return Inner->Flush();
+}
+
+
+FLowEntryByteDecompressionArchive::FLowEntryByteDecompressionArchive(TUniquePtr<FArchive>&& Inner0)
+	: Inner(MoveTemp(Inner0))
+{
+	SetIsLoading(true);
+	SetIsPersistent(true);
+
+	const int64 Start = Inner->Tell();
+	const int64 End = Inner->TotalSize();
+	int64 Offset = Start;
+	uint8 HeaderBytes[FLowEntryByteCompression::HeaderSize];
+	while ((End - Offset) >= FLowEntryByteCompression::HeaderSize)
+	{
+		Inner->Seek(Offset);
+		Inner->Serialize(HeaderBytes, FLowEntryByteCompression::HeaderSize);
+		FFrame Frame;
+		if (Inner->IsError() || !FLowEntryByteCompression::ReadHeader(HeaderBytes, Frame.Header))
+		{
+			break;
+		}
+		Frame.RawStart = RawTotalSize;
+		Frame.PayloadOffset = Offset + FLowEntryByteCompression::HeaderSize;
+		if (Frame.Header.PayloadSize > (End - Frame.PayloadOffset))
+		{
+			break;
+		}
+		if (Frame.Header.RawSize > 0)
+		{
+			Frames.Add(Frame);
+			RawTotalSize += Frame.Header.RawSize;
+		}
+		Offset = Frame.PayloadOffset + Frame.Header.PayloadSize;
+	}
+	if (Offset < End)
+	{
+		// a corrupt header or a truncated frame, which shouldn't read as a clean end of the data
+		SetError();
+	}
+}
+
+
+void FLowEntryByteDecompressionArchive::Serialize(void* Data, int64 Length)
+{
+	uint8* Dest = static_cast<uint8*>(Data);
+	while (Length > 0)
+	{
+		const int32 Index = FindFrame(Pos);
+		if ((Index == INDEX_NONE) || !LoadFrame(Index))
+		{
+			FMemory::Memzero(Dest, Length);
+			SetError();
+			return;
+		}
+		const FFrame& Frame = Frames[Index];
+		const int32 Offset = static_cast<int32>(Pos - Frame.RawStart);
+		const int32 Count = static_cast<int32>(FMath::Min<int64>(Length, Frame.Header.RawSize - Offset));
+		FMemory::Memcpy(Dest, CurrentBytes.GetData() + Offset, Count);
+		Dest += Count;
+		Length -= Count;
+		Pos += Count;
+	}
+}
+
+int64 FLowEntryByteDecompressionArchive::Tell()
+{
+	return Pos;
+}
+
+int64 FLowEntryByteDecompressionArchive::TotalSize()
+{
+	return RawTotalSize;
+}
+
+void FLowEntryByteDecompressionArchive::Seek(int64 InPos)
+{
+	Pos = FMath::Clamp<int64>(InPos, 0, RawTotalSize);
+}
+
+bool FLowEntryByteDecompressionArchive::Close()
+{
+	Frames.Empty();
+	RawTotalSize = 0;
+	Pos = 0;
+	CurrentFrame = INDEX_NONE;
+	CurrentBytes.Empty();
+	Payload.Empty();
+	return Inner->Close();
+}
+
+FString FLowEntryByteDecompressionArchive::GetArchiveName() const
+{
+	return TEXT("FLowEntryByteDecompressionArchive (") + Inner->GetArchiveName() + TEXT(")");
+}
+
+
+int32 FLowEntryByteDecompressionArchive::FindFrame(const int64 Position) const
+{
+	if ((Position < 0) || (Position >= RawTotalSize))
+	{
+		return INDEX_NONE;
+	}
+	if ((CurrentFrame != INDEX_NONE) && (Position >= Frames[CurrentFrame].RawStart) && (Position < (Frames[CurrentFrame].RawStart + Frames[CurrentFrame].Header.RawSize)))
+	{
+		return CurrentFrame;
+	}
+	int32 Low = 0;
+	int32 High = Frames.Num() - 1;
+	while (Low < High)
+	{
+		const int32 Middle = Low + ((High - Low + 1) / 2);
+		if (Frames[Middle].RawStart <= Position)
+		{
+			Low = Middle;
+		}
+		else
+		{
+			High = Middle - 1;
+		}
+	}
+	return Low;
+}
+
+bool FLowEntryByteDecompressionArchive::LoadFrame(const int32 Index)
+{
+	if (Index == CurrentFrame)
+	{
+		return true;
+	}
+	CurrentFrame = INDEX_NONE;
+	const FFrame& Frame = Frames[Index];
+	CurrentBytes.SetNumUninitialized(Frame.Header.RawSize, EAllowShrinking::No);
+
+	// raw frames are read directly into CurrentBytes, compressed frames go through Payload first
+	uint8* Dest = ((Frame.Header.Codec == FLowEntryByteCompression::CodecRaw) ? CurrentBytes.GetData() : nullptr);
+	if (Dest == nullptr)
+	{
+		Payload.SetNumUninitialized(Frame.Header.PayloadSize, EAllowShrinking::No);
+		Dest = Payload.GetData();
+	}
+	Inner->Seek(Frame.PayloadOffset);
+	Inner->Serialize(Dest, Frame.Header.PayloadSize);
+	if (Inner->IsError())
+	{
+		return false;
+	}
+	if ((Frame.Header.Codec != FLowEntryByteCompression::CodecRaw) && !FLowEntryByteCompression::DecodePayload(Frame.Header, Payload.GetData(), CurrentBytes.GetData()))
+	{
+		return false;
+	}
+	CurrentFrame = Index;
+	return true;
+}
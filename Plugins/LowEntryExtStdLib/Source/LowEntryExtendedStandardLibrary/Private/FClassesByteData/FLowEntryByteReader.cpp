@@ -0,0 +1,625 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteReader.h"
+
+#include "Misc/ByteSwap.h"
+
+
+FLowEntryByteReader::FLowEntryByteReader(const TArrayView<const uint8>& Bytes0)
+	: Bytes(Bytes0) {}
+
+
+int32 FLowEntryByteReader::GetAndIncreasePosition(const int32 Increasement)
+{
+	int32 Pos = Position;
+	if ((Bytes.Num() - Increasement) <= Position)
+	{
+		Position = Bytes.Num();
+	}
+	else
+	{
+		Position += Increasement;
+	}
+	return Pos;
+}
+
+int32 FLowEntryByteReader::MaxElementsRemaining(const int32 MinimumSizePerElement) const
+{
+	int32 RemainingCount = Remaining();
+	if (RemainingCount <= 0)
+	{
+		return 0;
+	}
+	if (MinimumSizePerElement <= 1)
+	{
+		return RemainingCount;
+	}
+	return (RemainingCount / MinimumSizePerElement) + 1;
+}
+
+
+int32 FLowEntryByteReader::ReadInteger(int32 Pos) const
+{
+	int32 Count = 4;
+	if (Pos < 0)
+	{
+		Count += Pos;
+		Pos = 0;
+	}
+	Count = FMath::Min(Count, Bytes.Num() - Pos);
+	if (Count >= 4)
+	{
+		uint32 Value;
+		FMemory::Memcpy(&Value, Bytes.GetData() + Pos, 4);
+#if PLATFORM_LITTLE_ENDIAN
+		Value = BYTESWAP_ORDER32(Value);
+#endif
+		return static_cast<int32>(Value);
+	}
+	int32 Value = 0;
+	for (int32 i = 0; i < Count; i++)
+	{
+		Value = (Value << 8) | Bytes[Pos + i];
+	}
+	return Value;
+}
+
+int64 FLowEntryByteReader::ReadLong(int32 Pos) const
+{
+	int32 Count = 8;
+	if (Pos < 0)
+	{
+		Count += Pos;
+		Pos = 0;
+	}
+	Count = FMath::Min(Count, Bytes.Num() - Pos);
+	if (Count >= 8)
+	{
+		uint64 Value;
+		FMemory::Memcpy(&Value, Bytes.GetData() + Pos, 8);
+#if PLATFORM_LITTLE_ENDIAN
+		Value = BYTESWAP_ORDER64(Value);
+#endif
+		return static_cast<int64>(Value);
+	}
+	int64 Value = 0;
+	for (int32 i = 0; i < Count; i++)
+	{
+		Value = (Value << 8) | static_cast<int64>(Bytes[Pos + i]);
+	}
+	return Value;
+}
+
+TArray<uint8> FLowEntryByteReader::ReadBytes(int32 Pos, const int32 Length) const
+{
+	int32 Count = Length;
+	if (Pos < 0)
+	{
+		Count += Pos;
+		Pos = 0;
+	}
+	Count = FMath::Min(Count, Bytes.Num() - Pos);
+	if (Count <= 0)
+	{
+		return TArray<uint8>();
+	}
+	return TArray<uint8>(Bytes.GetData() + Pos, Count);
+}
+
+uint64 FLowEntryByteReader::ReadVarint(const int32 MaxSize)
+{
+	const int32 Available = Bytes.Num() - Position;
+	if ((Position < 0) || (Available <= 0))
+	{
+		return 0;
+	}
+	uint64 Value;
+	const int32 Count = FLowEntryVarint::Read(Bytes.GetData() + Position, Available, MaxSize, Value);
+	Position += ((Count > 0) ? Count : FMath::Min(Available, MaxSize));
+	return Value;
+}
+
+int32 FLowEntryByteReader::GetRawBytes(uint8* Dest, const int32 Count)
+{
+	int32 Pos = GetAndIncreasePosition(Count);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	int32 Length = Count;
+	if (Pos < 0)
+	{
+		Length += Pos;
+		Pos = 0;
+	}
+	Length = FMath::Min(Length, Bytes.Num() - Pos);
+	if (Length <= 0)
+	{
+		return 0;
+	}
+	FMemory::Memcpy(Dest, Bytes.GetData() + Pos, Length);
+	return Length;
+}
+
+
+int32 FLowEntryByteReader::GetPosition() const
+{
+	return Position;
+}
+
+void FLowEntryByteReader::SetPosition(const int32 Position_)
+{
+	Position = Position_;
+}
+
+void FLowEntryByteReader::Reset()
+{
+	Position = 0;
+}
+
+void FLowEntryByteReader::Empty()
+{
+	Position = Bytes.Num();
+}
+
+int32 FLowEntryByteReader::Remaining() const
+{
+	return Bytes.Num() - Position;
+}
+
+
+uint8 FLowEntryByteReader::GetByte()
+{
+	int32 Pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	return Bytes[Pos];
+}
+
+int32 FLowEntryByteReader::GetInteger()
+{
+	int32 Pos = GetAndIncreasePosition(4);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	return ReadInteger(Pos);
+}
+
+int32 FLowEntryByteReader::GetUinteger()
+{
+	int32 Pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	uint8 B = Bytes[Pos];
+	if (((B >> 7) & 1) == 0)
+	{
+		return B;
+	}
+
+	Pos = GetAndIncreasePosition(3);
+	if (Bytes.Num() <= (Pos + 2))
+	{
+		return 0;
+	}
+	int32 Value = ((B & ~(1 << 7)) << 24) | (Bytes[Pos + 0] << 16) | (Bytes[Pos + 1] << 8) | Bytes[Pos + 2];
+	if (Value < 128)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryByteReader::GetPositiveInteger1()
+{
+	int32 Pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	uint8 B = Bytes[Pos];
+	if (((B >> 7) & 1) == 0)
+	{
+		return B;
+	}
+
+	Pos = GetAndIncreasePosition(3);
+	if (Bytes.Num() <= (Pos + 2))
+	{
+		return 0;
+	}
+	int32 Value = ((B & ~(1 << 7)) << 24) | (Bytes[Pos + 0] << 16) | (Bytes[Pos + 1] << 8) | Bytes[Pos + 2];
+	if (Value < 128)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryByteReader::GetPositiveInteger2()
+{
+	int32 Pos = GetAndIncreasePosition(2);
+	if (Bytes.Num() <= (Pos + 1))
+	{
+		return 0;
+	}
+	uint8 B1 = Bytes[Pos + 0];
+	uint8 B2 = Bytes[Pos + 1];
+	if (((B1 >> 7) & 1) == 0)
+	{
+		return (B1 << 8) | B2;
+	}
+
+	Pos = GetAndIncreasePosition(2);
+	if (Bytes.Num() <= (Pos + 1))
+	{
+		return 0;
+	}
+	int32 Value = ((B1 & ~(1 << 7)) << 24) | (B2 << 16) | (Bytes[Pos + 0] << 8) | Bytes[Pos + 1];
+	if (Value < 32768)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int32 FLowEntryByteReader::GetPositiveInteger3()
+{
+	int32 Pos = GetAndIncreasePosition(3);
+	if (Bytes.Num() <= (Pos + 2))
+	{
+		return 0;
+	}
+	uint8 B1 = Bytes[Pos + 0];
+	uint8 B2 = Bytes[Pos + 1];
+	uint8 B3 = Bytes[Pos + 2];
+	if (((B1 >> 7) & 1) == 0)
+	{
+		return (B1 << 16) | (B2 << 8) | B3;
+	}
+
+	Pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	int32 Value = ((B1 & ~(1 << 7)) << 24) | (B2 << 16) | (B3 << 8) | Bytes[Pos];
+	if (Value < 8388608)
+	{
+		return 0;
+	}
+	return Value;
+}
+
+int64 FLowEntryByteReader::GetLong()
+{
+	int32 Pos = GetAndIncreasePosition(8);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	return ReadLong(Pos);
+}
+
+float FLowEntryByteReader::GetFloat()
+{
+	int32 Pos = GetAndIncreasePosition(4);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	const int32 IntValue = ReadInteger(Pos);
+	float Value;
+	FMemory::Memcpy(&Value, &IntValue, 4);
+	return Value;
+}
+
+double FLowEntryByteReader::GetDouble()
+{
+	int32 Pos = GetAndIncreasePosition(8);
+	if (Bytes.Num() <= Pos)
+	{
+		return 0;
+	}
+	const int64 LongValue = ReadLong(Pos);
+	double Value;
+	FMemory::Memcpy(&Value, &LongValue, 8);
+	return Value;
+}
+
+bool FLowEntryByteReader::GetBoolean()
+{
+	int32 Pos = GetAndIncreasePosition(1);
+	if (Bytes.Num() <= Pos)
+	{
+		return false;
+	}
+	if (Pos < 0)
+	{
+		return false;
+	}
+	return (Bytes[Pos] == 0x01);
+}
+
+FString FLowEntryByteReader::GetStringUtf8()
+{
+	int32 Length = GetUinteger();
+	if (Length <= 0)
+	{
+		return TEXT("");
+	}
+	int32 Pos = GetAndIncreasePosition(Length);
+	if (Bytes.Num() <= Pos)
+	{
+		return TEXT("");
+	}
+	if (Pos < 0)
+	{
+		Length += Pos;
+		Pos = 0;
+	}
+	Length = FMath::Min(Length, Bytes.Num() - Pos);
+	if (Length <= 0)
+	{
+		return TEXT("");
+	}
+	const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Pos), Length);
+	return FString(Src.Length(), Src.Get());
+}
+
+
+int32 FLowEntryByteReader::GetVarInteger()
+{
+	return static_cast<int32>(ReadVarint(FLowEntryVarint::MaxIntegerSize));
+}
+
+int64 FLowEntryByteReader::GetVarLong()
+{
+	return static_cast<int64>(ReadVarint(FLowEntryVarint::MaxLongSize));
+}
+
+int32 FLowEntryByteReader::GetZigZagInteger()
+{
+	return FLowEntryVarint::ZigZagDecode(static_cast<uint32>(ReadVarint(FLowEntryVarint::MaxIntegerSize)));
+}
+
+int64 FLowEntryByteReader::GetZigZagLong()
+{
+	return FLowEntryVarint::ZigZagDecode(ReadVarint(FLowEntryVarint::MaxLongSize));
+}
+
+TArray<uint8> FLowEntryByteReader::GetByteArray()
+{
+	int32 Length = GetUinteger();
+	if (Length <= 0)
+	{
+		return TArray<uint8>();
+	}
+	int32 Pos = GetAndIncreasePosition(Length);
+	if (Bytes.Num() <= Pos)
+	{
+		return TArray<uint8>();
+	}
+	return ReadBytes(Pos, Length);
+}
+
+TArray<int32> FLowEntryByteReader::GetIntegerArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(4));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetInteger();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryByteReader::GetPositiveInteger1Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger1();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryByteReader::GetPositiveInteger2Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(2));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger2();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryByteReader::GetPositiveInteger3Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(3));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetPositiveInteger3();
+	}
+	return Array;
+}
+
+TArray<int64> FLowEntryByteReader::GetLongArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<int64>();
+	}
+	TArray<int64> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetLong();
+	}
+	return Array;
+}
+
+TArray<float> FLowEntryByteReader::GetFloatArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(4));
+	if (Length <= 0)
+	{
+		return TArray<float>();
+	}
+	TArray<float> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetFloat();
+	}
+	return Array;
+}
+
+TArray<double> FLowEntryByteReader::GetDoubleArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(8));
+	if (Length <= 0)
+	{
+		return TArray<double>();
+	}
+	TArray<double> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetDouble();
+	}
+	return Array;
+}
+
+TArray<bool> FLowEntryByteReader::GetBooleanArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, SafeMultiply(MaxElementsRemaining(1), 8));
+	if (Length <= 0)
+	{
+		return TArray<bool>();
+	}
+	TArray<bool> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i += 8)
+	{
+		uint8 B = GetByte();
+		for (int32 BIndex = 0; BIndex < 8; BIndex++)
+		{
+			int32 Index = i + BIndex;
+			if (Index >= Length)
+			{
+				return Array;
+			}
+			Array[Index] = (((B >> (7 - BIndex)) & 1) != 0);
+		}
+	}
+	return Array;
+}
+
+TArray<FString> FLowEntryByteReader::GetStringUtf8Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<FString>();
+	}
+	TArray<FString> Array;
+	Array.SetNumZeroed(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetStringUtf8();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryByteReader::GetIntegerArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNumUninitialized(Length);
+	uint32 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint32>(FLowEntryVarint::ZigZagDecode(static_cast<uint32>(ReadVarint(FLowEntryVarint::MaxIntegerSize))));
+		Array[i] = static_cast<int32>(Previous);
+	}
+	return Array;
+}
+
+TArray<int64> FLowEntryByteReader::GetLongArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int64>();
+	}
+	TArray<int64> Array;
+	Array.SetNumUninitialized(Length);
+	uint64 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint64>(FLowEntryVarint::ZigZagDecode(ReadVarint(FLowEntryVarint::MaxLongSize)));
+		Array[i] = static_cast<int64>(Previous);
+	}
+	return Array;
+}
+
+
+int32 FLowEntryByteReader::SafeMultiply(const int32 A, const int32 B)
+{
+	int64 Result = static_cast<int64>(A) * static_cast<int64>(B);
+	int32 Max = 2147483647;
+	int32 Min = (-2147483647 - 1);
+	if (Result >= Max)
+	{
+		return Max;
+	}
+	if (Result <= Min)
+	{
+		return Min;
+	}
+	return static_cast<int32>(Result);
+}
@@ -0,0 +1,85 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteSink.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+
+
+FLowEntryByteArchiveSink::FLowEntryByteArchiveSink(FArchive& Archive0)
+	: Archive(&Archive0) {}
+
+FLowEntryByteArchiveSink::FLowEntryByteArchiveSink(TUniquePtr<FArchive>&& Archive0)
+	: Archive(Archive0.Get())
+	, OwnedArchive(MoveTemp(Archive0)) {}
+
+FLowEntryByteArchiveSink::~FLowEntryByteArchiveSink()
+{
+	Flush();
+}
+
+TSharedPtr<FLowEntryByteArchiveSink, ESPMode::ThreadSafe> FLowEntryByteArchiveSink::OpenFile(const FString& FilePath, const bool Append)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath, (Append ? FILEWRITE_Append : FILEWRITE_None)));
+	if (!FileWriter.IsValid())
+	{
+		return nullptr;
+	}
+	return MakeShared<FLowEntryByteArchiveSink, ESPMode::ThreadSafe>(MoveTemp(FileWriter));
+}
+
+
+void FLowEntryByteArchiveSink::Write(TArray<uint8>& Chunk)
+{
+	WaitForPendingWrite();
+	Swap(Pending, Chunk);
+	Chunk.Reset();
+	if (Pending.Num() <= 0)
+	{
+		return;
+	}
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		Archive->Serialize(Pending.GetData(), Pending.Num());
+		return !Archive->IsError();
+	});
+}
+
+bool FLowEntryByteArchiveSink::Flush()
+{
+	WaitForPendingWrite();
+	Archive->Flush();
+	return (!Failed && !Archive->IsError());
+}
+
+void FLowEntryByteArchiveSink::WaitForPendingWrite()
+{
+	if (!PendingWrite.IsValid())
+	{
+		return;
+	}
+	if (!PendingWrite.Get())
+	{
+		Failed = true;
+	}
+	PendingWrite = TFuture<bool>();
+}
+
+
+FLowEntryByteCallbackSink::FLowEntryByteCallbackSink(TFunction<bool(const TArrayView<const uint8>&)>&& Callback0)
+	: Callback(MoveTemp(Callback0)) {}
+
+void FLowEntryByteCallbackSink::Write(TArray<uint8>& Chunk)
+{
+	if ((Chunk.Num() > 0) && !Callback(Chunk))
+	{
+		Failed = true;
+	}
+	Chunk.Reset();
+}
+
+bool FLowEntryByteCallbackSink::Flush()
+{
+	return !Failed;
+}
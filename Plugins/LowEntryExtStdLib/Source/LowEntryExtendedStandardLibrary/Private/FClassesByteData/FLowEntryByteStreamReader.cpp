@@ -0,0 +1,479 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteStreamReader.h"
+#include "FLowEntryByteCompression.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+
+
+FLowEntryByteStreamReader::FLowEntryByteStreamReader(FArchive& Archive0, const int32 ChunkSize0)
+	: Archive(&Archive0)
+	, ChunkSize(FMath::Max(ChunkSize0, 64))
+{
+	Origin = Archive->Tell();
+	TotalSize = FMath::Max<int64>(Archive->TotalSize() - Origin, 0);
+	Window.Reserve(ChunkSize * 2);
+}
+
+FLowEntryByteStreamReader::FLowEntryByteStreamReader(TUniquePtr<FArchive>&& Archive0, const int32 ChunkSize0)
+	: FLowEntryByteStreamReader(*Archive0, ChunkSize0)
+{
+	OwnedArchive = MoveTemp(Archive0);
+}
+
+FLowEntryByteStreamReader::~FLowEntryByteStreamReader()
+{
+	WaitForPrefetch();
+	if ((Archive != nullptr) && !OwnedArchive.IsValid())
+	{
+		// leaves a borrowed archive right after the data that has been read, so the caller can continue reading from there
+		Archive->Seek(Origin + Position);
+	}
+}
+
+TUniquePtr<FLowEntryByteStreamReader> FLowEntryByteStreamReader::OpenFile(const FString& FilePath, const int32 ChunkSize)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader.IsValid())
+	{
+		return nullptr;
+	}
+	return MakeUnique<FLowEntryByteStreamReader>(MoveTemp(FileReader), ChunkSize);
+}
+
+TUniquePtr<FLowEntryByteStreamReader> FLowEntryByteStreamReader::OpenCompressedFile(const FString& FilePath, const int32 ChunkSize)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader.IsValid())
+	{
+		return nullptr;
+	}
+	TUniquePtr<FArchive> Decompressor = MakeUnique<FLowEntryByteDecompressionArchive>(MoveTemp(FileReader));
+	if (Decompressor->IsError())
+	{
+		return nullptr;
+	}
+	return MakeUnique<FLowEntryByteStreamReader>(MoveTemp(Decompressor), ChunkSize);
+}
+
+
+int64 FLowEntryByteStreamReader::GetPosition() const
+{
+	return Position;
+}
+
+void FLowEntryByteStreamReader::SetPosition(const int64 Position_)
+{
+	Position = FMath::Clamp<int64>(Position_, 0, TotalSize);
+}
+
+void FLowEntryByteStreamReader::Reset()
+{
+	Position = 0;
+}
+
+void FLowEntryByteStreamReader::Empty()
+{
+	Position = TotalSize;
+}
+
+int64 FLowEntryByteStreamReader::Num() const
+{
+	return TotalSize;
+}
+
+int64 FLowEntryByteStreamReader::Remaining() const
+{
+	return TotalSize - Position;
+}
+
+int32 FLowEntryByteStreamReader::MaxElementsRemaining(const int32 MinimumSizePerElement) const
+{
+	const int64 RemainingCount = Remaining();
+	if (RemainingCount <= 0)
+	{
+		return 0;
+	}
+	if (MinimumSizePerElement <= 1)
+	{
+		return static_cast<int32>(FMath::Min<int64>(RemainingCount, MAX_int32));
+	}
+	return static_cast<int32>(FMath::Min<int64>((RemainingCount / MinimumSizePerElement) + 1, MAX_int32));
+}
+
+void FLowEntryByteStreamReader::Close()
+{
+	WaitForPrefetch();
+	OwnedArchive.Reset();
+	Archive = nullptr;
+	TotalSize = 0;
+	Position = 0;
+	Window.Empty();
+	WindowStart = 0;
+	PrefetchBuffer.Empty();
+}
+
+
+TArrayView<const uint8> FLowEntryByteStreamReader::Ensure(const int32 Count)
+{
+	const int32 Available = static_cast<int32>(FMath::Min<int64>(Count, Remaining()));
+	if (Available <= 0)
+	{
+		return TArrayView<const uint8>();
+	}
+	if ((Position < WindowStart) || ((Position + Available) > (WindowStart + Window.Num())))
+	{
+		Fill(Available);
+		// if the archive failed, Fill() has shortened the data to what could be read
+		return TArrayView<const uint8>(Window.GetData(), FMath::Min(Available, Window.Num()));
+	}
+	return TArrayView<const uint8>(Window.GetData() + (Position - WindowStart), Available);
+}
+
+void FLowEntryByteStreamReader::Fill(const int32 Count)
+{
+	// keeps the bytes of the window that haven't been read yet, and moves them to the front
+	const int64 WindowEnd = WindowStart + Window.Num();
+	int32 Kept = 0;
+	if ((Position >= WindowStart) && (Position < WindowEnd))
+	{
+		Kept = static_cast<int32>(WindowEnd - Position);
+		FMemory::Memmove(Window.GetData(), Window.GetData() + (Position - WindowStart), Kept);
+	}
+	Window.SetNum(Kept, EAllowShrinking::No);
+	WindowStart = Position;
+
+	const int64 ReadStart = WindowStart + Kept;
+	if ((ReadStart == PrefetchStart) && Prefetch.IsValid())
+	{
+		if (WaitForPrefetch())
+		{
+			Window.Append(PrefetchBuffer);
+		}
+		else
+		{
+			TotalSize = ReadStart;
+		}
+	}
+	else
+	{
+		WaitForPrefetch();
+	}
+
+	const int32 Missing = static_cast<int32>(FMath::Min<int64>(Count, TotalSize - WindowStart)) - Window.Num();
+	if (Missing > 0)
+	{
+		const int64 Start = WindowStart + Window.Num();
+		const int32 ReadCount = static_cast<int32>(FMath::Min<int64>(FMath::Max(ChunkSize, Missing), TotalSize - Start));
+		const int32 OldNum = Window.Num();
+		Window.SetNumUninitialized(OldNum + ReadCount, EAllowShrinking::No);
+		if (!ReadFromArchive(Start, Window.GetData() + OldNum, ReadCount))
+		{
+			Window.SetNum(OldNum, EAllowShrinking::No);
+			TotalSize = Start;
+		}
+	}
+
+	StartPrefetch(WindowStart + Window.Num());
+}
+
+void FLowEntryByteStreamReader::StartPrefetch(const int64 Start)
+{
+	if ((Archive == nullptr) || (Start >= TotalSize))
+	{
+		return;
+	}
+	const int32 Count = static_cast<int32>(FMath::Min<int64>(ChunkSize, TotalSize - Start));
+	PrefetchStart = Start;
+	Prefetch = Async(EAsyncExecution::ThreadPool, [this, Start, Count]()
+	{
+		PrefetchBuffer.SetNumUninitialized(Count, EAllowShrinking::No);
+		return ReadFromArchive(Start, PrefetchBuffer.GetData(), Count);
+	});
+}
+
+bool FLowEntryByteStreamReader::WaitForPrefetch()
+{
+	if (!Prefetch.IsValid())
+	{
+		return false;
+	}
+	const bool Success = Prefetch.Get();
+	Prefetch = TFuture<bool>();
+	PrefetchStart = -1;
+	return Success;
+}
+
+bool FLowEntryByteStreamReader::ReadFromArchive(const int64 Start, uint8* Dest, const int32 Count)
+{
+	if (Archive == nullptr)
+	{
+		return false;
+	}
+	Archive->Seek(Origin + Start);
+	Archive->Serialize(Dest, Count);
+	return !Archive->IsError();
+}
+
+
+int32 FLowEntryByteStreamReader::GetRawBytes(uint8* Dest, const int32 Count)
+{
+	const int32 Length = static_cast<int32>(FMath::Min<int64>(Count, Remaining()));
+	if (Length <= 0)
+	{
+		return 0;
+	}
+	if (Length <= ChunkSize)
+	{
+		const TArrayView<const uint8> Bytes = Ensure(Length);
+		FMemory::Memcpy(Dest, Bytes.GetData(), Bytes.Num());
+		Position += Bytes.Num();
+		return Bytes.Num();
+	}
+
+	// larger than a chunk, copies what's resident and reads the rest straight into Dest
+	int32 Resident = 0;
+	const int64 WindowEnd = WindowStart + Window.Num();
+	if ((Position >= WindowStart) && (Position < WindowEnd))
+	{
+		Resident = static_cast<int32>(FMath::Min<int64>(Length, WindowEnd - Position));
+		FMemory::Memcpy(Dest, Window.GetData() + (Position - WindowStart), Resident);
+	}
+	WaitForPrefetch();
+	int32 Read = Length;
+	if (!ReadFromArchive(Position + Resident, Dest + Resident, Length - Resident))
+	{
+		Read = Resident;
+		TotalSize = Position + Resident;
+	}
+	Position += Read;
+	Window.Reset();
+	WindowStart = Position;
+	StartPrefetch(Position);
+	return Read;
+}
+
+int32 FLowEntryByteStreamReader::GetUinteger()
+{
+	return Decode(4, &FLowEntryByteReader::GetUinteger);
+}
+
+
+uint8 FLowEntryByteStreamReader::GetByte()
+{
+	return Decode(1, &FLowEntryByteReader::GetByte);
+}
+
+int32 FLowEntryByteStreamReader::GetInteger()
+{
+	return Decode(4, &FLowEntryByteReader::GetInteger);
+}
+
+int32 FLowEntryByteStreamReader::GetPositiveInteger1()
+{
+	return Decode(4, &FLowEntryByteReader::GetPositiveInteger1);
+}
+
+int32 FLowEntryByteStreamReader::GetPositiveInteger2()
+{
+	return Decode(4, &FLowEntryByteReader::GetPositiveInteger2);
+}
+
+int32 FLowEntryByteStreamReader::GetPositiveInteger3()
+{
+	return Decode(4, &FLowEntryByteReader::GetPositiveInteger3);
+}
+
+int64 FLowEntryByteStreamReader::GetLong()
+{
+	return Decode(8, &FLowEntryByteReader::GetLong);
+}
+
+float FLowEntryByteStreamReader::GetFloat()
+{
+	return Decode(4, &FLowEntryByteReader::GetFloat);
+}
+
+double FLowEntryByteStreamReader::GetDouble()
+{
+	return Decode(8, &FLowEntryByteReader::GetDouble);
+}
+
+bool FLowEntryByteStreamReader::GetBoolean()
+{
+	return Decode(1, &FLowEntryByteReader::GetBoolean);
+}
+
+FString FLowEntryByteStreamReader::GetStringUtf8()
+{
+	const int32 Length = static_cast<int32>(FMath::Min<int64>(GetUinteger(), Remaining()));
+	if (Length <= 0)
+	{
+		return TEXT("");
+	}
+	if (Length <= ChunkSize)
+	{
+		const TArrayView<const uint8> Bytes = Ensure(Length);
+		Position += Bytes.Num();
+		const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+		return FString(Src.Length(), Src.Get());
+	}
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(Length);
+	Bytes.SetNum(GetRawBytes(Bytes.GetData(), Length), EAllowShrinking::No);
+	const FUTF8ToTCHAR Src(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+	return FString(Src.Length(), Src.Get());
+}
+
+// the window is always made MaxLongSize bytes long (if possible), so that FLowEntryByteReader can decode var integers without looping over the bytes
+
+int32 FLowEntryByteStreamReader::GetVarInteger()
+{
+	return Decode(FLowEntryVarint::MaxLongSize, &FLowEntryByteReader::GetVarInteger);
+}
+
+int64 FLowEntryByteStreamReader::GetVarLong()
+{
+	return Decode(FLowEntryVarint::MaxLongSize, &FLowEntryByteReader::GetVarLong);
+}
+
+int32 FLowEntryByteStreamReader::GetZigZagInteger()
+{
+	return Decode(FLowEntryVarint::MaxLongSize, &FLowEntryByteReader::GetZigZagInteger);
+}
+
+int64 FLowEntryByteStreamReader::GetZigZagLong()
+{
+	return Decode(FLowEntryVarint::MaxLongSize, &FLowEntryByteReader::GetZigZagLong);
+}
+
+TArray<uint8> FLowEntryByteStreamReader::GetByteArray()
+{
+	const int32 Length = static_cast<int32>(FMath::Min<int64>(GetUinteger(), Remaining()));
+	if (Length <= 0)
+	{
+		return TArray<uint8>();
+	}
+	TArray<uint8> Array;
+	Array.SetNumUninitialized(Length);
+	Array.SetNum(GetRawBytes(Array.GetData(), Length), EAllowShrinking::No);
+	return Array;
+}
+
+TArray<int32> FLowEntryByteStreamReader::GetIntegerArray()
+{
+	return DecodeArray(4, 4, &FLowEntryByteReader::GetInteger);
+}
+
+TArray<int32> FLowEntryByteStreamReader::GetPositiveInteger1Array()
+{
+	return DecodeArray(1, 4, &FLowEntryByteReader::GetPositiveInteger1);
+}
+
+TArray<int32> FLowEntryByteStreamReader::GetPositiveInteger2Array()
+{
+	return DecodeArray(2, 4, &FLowEntryByteReader::GetPositiveInteger2);
+}
+
+TArray<int32> FLowEntryByteStreamReader::GetPositiveInteger3Array()
+{
+	return DecodeArray(3, 4, &FLowEntryByteReader::GetPositiveInteger3);
+}
+
+TArray<int64> FLowEntryByteStreamReader::GetLongArray()
+{
+	return DecodeArray(8, 8, &FLowEntryByteReader::GetLong);
+}
+
+TArray<float> FLowEntryByteStreamReader::GetFloatArray()
+{
+	return DecodeArray(4, 4, &FLowEntryByteReader::GetFloat);
+}
+
+TArray<double> FLowEntryByteStreamReader::GetDoubleArray()
+{
+	return DecodeArray(8, 8, &FLowEntryByteReader::GetDouble);
+}
+
+TArray<bool> FLowEntryByteStreamReader::GetBooleanArray()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, FLowEntryByteReader::SafeMultiply(MaxElementsRemaining(1), 8));
+	if (Length <= 0)
+	{
+		return TArray<bool>();
+	}
+	TArray<bool> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i += 8)
+	{
+		uint8 B = GetByte();
+		for (int32 BIndex = 0; BIndex < 8; BIndex++)
+		{
+			int32 Index = i + BIndex;
+			if (Index >= Length)
+			{
+				return Array;
+			}
+			Array[Index] = (((B >> (7 - BIndex)) & 1) != 0);
+		}
+	}
+	return Array;
+}
+
+TArray<FString> FLowEntryByteStreamReader::GetStringUtf8Array()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<FString>();
+	}
+	TArray<FString> Array;
+	Array.SetNum(Length);
+	for (int32 i = 0; i < Length; i++)
+	{
+		Array[i] = GetStringUtf8();
+	}
+	return Array;
+}
+
+TArray<int32> FLowEntryByteStreamReader::GetIntegerArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int32>();
+	}
+	TArray<int32> Array;
+	Array.SetNumUninitialized(Length);
+	uint32 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint32>(GetZigZagInteger());
+		Array[i] = static_cast<int32>(Previous);
+	}
+	return Array;
+}
+
+TArray<int64> FLowEntryByteStreamReader::GetLongArrayDelta()
+{
+	int32 Length = GetUinteger();
+	Length = FMath::Min(Length, MaxElementsRemaining(1));
+	if (Length <= 0)
+	{
+		return TArray<int64>();
+	}
+	TArray<int64> Array;
+	Array.SetNumUninitialized(Length);
+	uint64 Previous = 0;
+	for (int32 i = 0; i < Length; i++)
+	{
+		Previous += static_cast<uint64>(GetZigZagLong());
+		Array[i] = static_cast<int64>(Previous);
+	}
+	return Array;
+}
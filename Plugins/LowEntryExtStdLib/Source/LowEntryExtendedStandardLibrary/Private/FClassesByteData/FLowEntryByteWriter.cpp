@@ -0,0 +1,579 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryByteWriter.h"
+
+#include "Misc/ByteSwap.h"
+#include "Async/Async.h"
+
+
+FLowEntryByteWriter::FLowEntryByteWriter(const int32 InitialCapacity)
+{
+	Reserve(InitialCapacity);
+}
+
+FLowEntryByteWriter::FLowEntryByteWriter(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink_, const int32 ChunkSize)
+{
+	SetSink(Sink_, ChunkSize);
+}
+
+
+void FLowEntryByteWriter::AddRawByte(const uint8 Value)
+{
+	FlushIfFull();
+	Bytes.Add(Value);
+}
+
+void FLowEntryByteWriter::AddRawBytes(const TArrayView<const uint8>& Value)
+{
+	if (!Sink.IsValid())
+	{
+		Bytes.Append(Value);
+		return;
+	}
+	// split into chunks, so that large byte arrays don't have to be buffered completely
+	const uint8* Data = Value.GetData();
+	int32 Remaining = Value.Num();
+	while (Remaining > 0)
+	{
+		FlushIfFull();
+		const int32 Count = FMath::Min(Remaining, FlushThreshold - Bytes.Num());
+		Bytes.Append(Data, Count);
+		Data += Count;
+		Remaining -= Count;
+	}
+}
+
+void FLowEntryByteWriter::AddRawBytes(const FLowEntryByteChain& Value)
+{
+	if (Sink.IsValid())
+	{
+		Value.ForEachFragment([this](const TArrayView<const uint8>& Fragment)
+		{
+			AddRawBytes(Fragment);
+		});
+		return;
+	}
+	const int64 Size = Value.Num();
+	if ((Size <= 0) || ((Bytes.Num() + Size) > 0x7fffffff))
+	{
+		return;
+	}
+	Value.CopyTo(AddUninitializedRawBytes(static_cast<int32>(Size)));
+}
+
+
+void FLowEntryByteWriter::WriteChunk()
+{
+	if (!Sink.IsValid() || (Bytes.Num() <= 0))
+	{
+		return;
+	}
+	FlushedCount += Bytes.Num();
+	Sink->Write(Bytes);
+}
+
+uint8* FLowEntryByteWriter::AddUninitializedRawBytes(const int32 Count)
+{
+	const int32 Index = Bytes.AddUninitialized(Count);
+	return Bytes.GetData() + Index;
+}
+
+void FLowEntryByteWriter::TrimRawBytes(const int32 Num)
+{
+	Bytes.SetNum(Num, EAllowShrinking::No);
+}
+
+void FLowEntryByteWriter::AddVarint(const uint64 Value, const int32 MaxSize)
+{
+	FlushIfFull();
+	const int32 Start = Bytes.Num();
+	TrimRawBytes(Start + FLowEntryVarint::Write(AddUninitializedRawBytes(MaxSize), Value));
+}
+
+
+int32 FLowEntryByteWriter::WriteUinteger(uint8* Dest, const int32 Value)
+{
+	if (Value <= 0)
+	{
+		Dest[0] = 0;
+		return 1;
+	}
+	if (Value < 128)
+	{
+		Dest[0] = Value;
+		return 1;
+	}
+	WriteInteger(Dest, Value | static_cast<int32>(0x80000000));
+	return 4;
+}
+
+int32 FLowEntryByteWriter::WritePositiveInteger2(uint8* Dest, const int32 Value)
+{
+	if (Value <= 0)
+	{
+		Dest[0] = 0;
+		Dest[1] = 0;
+		return 2;
+	}
+	if (Value < 32768)
+	{
+		Dest[0] = (Value >> 8);
+		Dest[1] = Value;
+		return 2;
+	}
+	WriteInteger(Dest, Value | static_cast<int32>(0x80000000));
+	return 4;
+}
+
+int32 FLowEntryByteWriter::WritePositiveInteger3(uint8* Dest, const int32 Value)
+{
+	if (Value <= 0)
+	{
+		Dest[0] = 0;
+		Dest[1] = 0;
+		Dest[2] = 0;
+		return 3;
+	}
+	if (Value < 8388608)
+	{
+		Dest[0] = (Value >> 16);
+		Dest[1] = (Value >> 8);
+		Dest[2] = Value;
+		return 3;
+	}
+	WriteInteger(Dest, Value | static_cast<int32>(0x80000000));
+	return 4;
+}
+
+void FLowEntryByteWriter::WriteInteger(uint8* Dest, const int32 Value)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	const uint32 BigEndian = BYTESWAP_ORDER32(static_cast<uint32>(Value));
+#else
+	const uint32 BigEndian = static_cast<uint32>(Value);
+#endif
+	FMemory::Memcpy(Dest, &BigEndian, 4);
+}
+
+void FLowEntryByteWriter::WriteLong(uint8* Dest, const int64 Value)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	const uint64 BigEndian = BYTESWAP_ORDER64(static_cast<uint64>(Value));
+#else
+	const uint64 BigEndian = static_cast<uint64>(Value);
+#endif
+	FMemory::Memcpy(Dest, &BigEndian, 8);
+}
+
+void FLowEntryByteWriter::WriteIntegers(uint8* Dest, const int32* Values, const int32 Num)
+{
+	// simple enough for the compiler to turn into vectorized byte shuffles
+	for (int32 i = 0; i < Num; i++)
+	{
+		WriteInteger(Dest + (i * 4), Values[i]);
+	}
+}
+
+void FLowEntryByteWriter::WriteLongs(uint8* Dest, const int64* Values, const int32 Num)
+{
+	// simple enough for the compiler to turn into vectorized byte shuffles
+	for (int32 i = 0; i < Num; i++)
+	{
+		WriteLong(Dest + (i * 8), Values[i]);
+	}
+}
+
+
+const TArray<uint8>& FLowEntryByteWriter::GetBytes() const
+{
+	return Bytes;
+}
+
+TArray<uint8> FLowEntryByteWriter::TakeBytes()
+{
+	TArray<uint8> Result = MoveTemp(Bytes);
+	Bytes.Reset();
+	FlushedCount = 0;
+	return Result;
+}
+
+int64 FLowEntryByteWriter::Num() const
+{
+	return FlushedCount + Bytes.Num();
+}
+
+void FLowEntryByteWriter::Reset()
+{
+	Bytes.Reset();
+	FlushedCount = 0;
+}
+
+void FLowEntryByteWriter::SetSink(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink_, const int32 ChunkSize)
+{
+	if (Sink.IsValid() && (Sink != Sink_))
+	{
+		Flush();
+	}
+	Sink = Sink_;
+	FlushThreshold = (Sink.IsValid() ? FMath::Max(ChunkSize, 64) : MAX_int32);
+	if (Sink.IsValid())
+	{
+		Bytes.Reserve(FlushThreshold);
+	}
+}
+
+bool FLowEntryByteWriter::HasSink() const
+{
+	return Sink.IsValid();
+}
+
+bool FLowEntryByteWriter::Flush()
+{
+	if (!Sink.IsValid())
+	{
+		return true;
+	}
+	WriteChunk();
+	return Sink->Flush();
+}
+
+void FLowEntryByteWriter::ReleaseSink()
+{
+	if (!Sink.IsValid())
+	{
+		return;
+	}
+	Async(EAsyncExecution::ThreadPool, [Released = MoveTemp(Sink), Chunk = MoveTemp(Bytes)]() mutable
+	{
+		if (Chunk.Num() > 0)
+		{
+			Released->Write(Chunk);
+		}
+		Released->Flush();
+	});
+	Sink.Reset();
+	Bytes.Reset();
+	FlushThreshold = MAX_int32;
+	FlushedCount = 0;
+}
+
+void FLowEntryByteWriter::Reserve(const int32 ByteCount)
+{
+	if (ByteCount > 0)
+	{
+		Bytes.Reserve(Bytes.Num() + ByteCount);
+	}
+}
+
+
+void FLowEntryByteWriter::AddByte(const uint8 Value)
+{
+	AddRawByte(Value);
+}
+void FLowEntryByteWriter::AddInteger(const int32 Value)
+{
+	FlushIfFull();
+	WriteInteger(AddUninitializedRawBytes(4), Value);
+}
+void FLowEntryByteWriter::AddUinteger(const int32 Value)
+{
+	FlushIfFull();
+	const int32 Start = Bytes.Num();
+	TrimRawBytes(Start + WriteUinteger(AddUninitializedRawBytes(4), Value));
+}
+void FLowEntryByteWriter::AddPositiveInteger1(const int32 Value)
+{
+	FlushIfFull();
+	const int32 Start = Bytes.Num();
+	TrimRawBytes(Start + WriteUinteger(AddUninitializedRawBytes(4), Value));
+}
+void FLowEntryByteWriter::AddPositiveInteger2(const int32 Value)
+{
+	FlushIfFull();
+	const int32 Start = Bytes.Num();
+	TrimRawBytes(Start + WritePositiveInteger2(AddUninitializedRawBytes(4), Value));
+}
+void FLowEntryByteWriter::AddPositiveInteger3(const int32 Value)
+{
+	FlushIfFull();
+	const int32 Start = Bytes.Num();
+	TrimRawBytes(Start + WritePositiveInteger3(AddUninitializedRawBytes(4), Value));
+}
+void FLowEntryByteWriter::AddLong(const int64 Value)
+{
+	FlushIfFull();
+	WriteLong(AddUninitializedRawBytes(8), Value);
+}
+void FLowEntryByteWriter::AddFloat(const float Value)
+{
+	FlushIfFull();
+	int32 IntValue;
+	FMemory::Memcpy(&IntValue, &Value, 4);
+	WriteInteger(AddUninitializedRawBytes(4), IntValue);
+}
+void FLowEntryByteWriter::AddDouble(const double Value)
+{
+	FlushIfFull();
+	int64 LongValue;
+	FMemory::Memcpy(&LongValue, &Value, 8);
+	WriteLong(AddUninitializedRawBytes(8), LongValue);
+}
+void FLowEntryByteWriter::AddBoolean(const bool Value)
+{
+	if (Value)
+	{
+		AddRawByte(0x01);
+	}
+	else
+	{
+		AddRawByte(0x00);
+	}
+}
+void FLowEntryByteWriter::AddStringUtf8(const FString& Value)
+{
+	if (Value.Len() <= 0)
+	{
+		AddUinteger(0);
+		return;
+	}
+	const FTCHARToUTF8 Src = FTCHARToUTF8(Value.GetCharArray().GetData());
+	const int32 Size = Src.Length();
+	if (Size <= 0)
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	FMemory::Memcpy(AddUninitializedRawBytes(Size), Src.Get(), Size);
+}
+
+void FLowEntryByteWriter::AddVarInteger(const int32 Value)
+{
+	AddVarint(static_cast<uint32>(Value), FLowEntryVarint::MaxIntegerSize);
+}
+void FLowEntryByteWriter::AddVarLong(const int64 Value)
+{
+	AddVarint(static_cast<uint64>(Value), FLowEntryVarint::MaxLongSize);
+}
+void FLowEntryByteWriter::AddZigZagInteger(const int32 Value)
+{
+	AddVarint(FLowEntryVarint::ZigZagEncode(Value), FLowEntryVarint::MaxIntegerSize);
+}
+void FLowEntryByteWriter::AddZigZagLong(const int64 Value)
+{
+	AddVarint(FLowEntryVarint::ZigZagEncode(Value), FLowEntryVarint::MaxLongSize);
+}
+
+void FLowEntryByteWriter::AddByteArray(const TArrayView<const uint8>& Value)
+{
+	int64 Size = Value.Num();
+	// a streaming writer splits the bytes into chunks, otherwise they have to fit in the buffer
+	if ((Size <= 0) || (Size > 0x7fffffff) || (!Sink.IsValid() && !HasRoomFor(Size)))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	AddRawBytes(Value);
+}
+void FLowEntryByteWriter::AddByteArray(const FLowEntryByteChain& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || (!Sink.IsValid() && !HasRoomFor(Size)))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	AddRawBytes(Value);
+}
+void FLowEntryByteWriter::AddIntegerArray(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 4))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	WriteIntegers(AddUninitializedRawBytes(Size * 4), Value.GetData(), Size);
+}
+void FLowEntryByteWriter::AddPositiveInteger1Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 4))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	const int32 Start = Bytes.Num();
+	uint8* Dest = AddUninitializedRawBytes(Size * 4);
+	int32 Written = 0;
+	for (int32 V : Value)
+	{
+		Written += WriteUinteger(Dest + Written, V);
+	}
+	TrimRawBytes(Start + Written);
+}
+void FLowEntryByteWriter::AddPositiveInteger2Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 4))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	const int32 Start = Bytes.Num();
+	uint8* Dest = AddUninitializedRawBytes(Size * 4);
+	int32 Written = 0;
+	for (int32 V : Value)
+	{
+		Written += WritePositiveInteger2(Dest + Written, V);
+	}
+	TrimRawBytes(Start + Written);
+}
+void FLowEntryByteWriter::AddPositiveInteger3Array(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 4))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	const int32 Start = Bytes.Num();
+	uint8* Dest = AddUninitializedRawBytes(Size * 4);
+	int32 Written = 0;
+	for (int32 V : Value)
+	{
+		Written += WritePositiveInteger3(Dest + Written, V);
+	}
+	TrimRawBytes(Start + Written);
+}
+void FLowEntryByteWriter::AddLongArray(const TArrayView<const int64>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 8))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	WriteLongs(AddUninitializedRawBytes(Size * 8), Value.GetData(), Size);
+}
+void FLowEntryByteWriter::AddFloatArray(const TArrayView<const float>& Value)
+{
+	static_assert(sizeof(float) == sizeof(int32), "float is expected to be 4 bytes");
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 4))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	WriteIntegers(AddUninitializedRawBytes(Size * 4), reinterpret_cast<const int32*>(Value.GetData()), Size);
+}
+void FLowEntryByteWriter::AddDoubleArray(const TArrayView<const double>& Value)
+{
+	static_assert(sizeof(double) == sizeof(int64), "double is expected to be 8 bytes");
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor(Size * 8))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	WriteLongs(AddUninitializedRawBytes(Size * 8), reinterpret_cast<const int64*>(Value.GetData()), Size);
+}
+void FLowEntryByteWriter::AddBooleanArray(const TArrayView<const bool>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || !HasRoomFor((Size + 7) / 8))
+	{
+		AddUinteger(0);
+		return;
+	}
+	const int32 ByteCount = (Size + 7) / 8;
+	AddUinteger(Size);
+	uint8* Dest = AddUninitializedRawBytes(ByteCount);
+	FMemory::Memzero(Dest, ByteCount);
+	for (int32 i = 0; i < Size; i++)
+	{
+		if (Value[i])
+		{
+			Dest[i >> 3] |= (1 << (7 - (i & 7)));
+		}
+	}
+}
+void FLowEntryByteWriter::AddStringUtf8Array(const TArrayView<const FString>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	for (const FString& V : Value)
+	{
+		AddStringUtf8(V);
+	}
+}
+void FLowEntryByteWriter::AddIntegerArrayDelta(const TArrayView<const int32>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || (!Sink.IsValid() && !HasRoomFor(Size * FLowEntryVarint::MaxIntegerSize)))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	// encoded in blocks, so that only a block worth of bytes is over-allocated, and so that a streaming writer can flush in between
+	const int32 BlockSize = 1024;
+	int32 Previous = 0;
+	for (int32 BlockStart = 0; BlockStart < Size; BlockStart += BlockSize)
+	{
+		const int32 BlockEnd = FMath::Min(BlockStart + BlockSize, static_cast<int32>(Size));
+		FlushIfFull();
+		const int32 Start = Bytes.Num();
+		uint8* Dest = AddUninitializedRawBytes((BlockEnd - BlockStart) * FLowEntryVarint::MaxIntegerSize);
+		int32 Written = 0;
+		for (int32 i = BlockStart; i < BlockEnd; i++)
+		{
+			const int32 Delta = static_cast<int32>(static_cast<uint32>(Value[i]) - static_cast<uint32>(Previous));
+			Written += FLowEntryVarint::Write(Dest + Written, FLowEntryVarint::ZigZagEncode(Delta));
+			Previous = Value[i];
+		}
+		TrimRawBytes(Start + Written);
+	}
+}
+void FLowEntryByteWriter::AddLongArrayDelta(const TArrayView<const int64>& Value)
+{
+	int64 Size = Value.Num();
+	if ((Size <= 0) || (Size > 0x7fffffff) || (!Sink.IsValid() && !HasRoomFor(Size * FLowEntryVarint::MaxLongSize)))
+	{
+		AddUinteger(0);
+		return;
+	}
+	AddUinteger(Size);
+	// encoded in blocks, so that only a block worth of bytes is over-allocated, and so that a streaming writer can flush in between
+	const int32 BlockSize = 1024;
+	int64 Previous = 0;
+	for (int32 BlockStart = 0; BlockStart < Size; BlockStart += BlockSize)
+	{
+		const int32 BlockEnd = FMath::Min(BlockStart + BlockSize, static_cast<int32>(Size));
+		FlushIfFull();
+		const int32 Start = Bytes.Num();
+		uint8* Dest = AddUninitializedRawBytes((BlockEnd - BlockStart) * FLowEntryVarint::MaxLongSize);
+		int32 Written = 0;
+		for (int32 i = BlockStart; i < BlockEnd; i++)
+		{
+			const int64 Delta = static_cast<int64>(static_cast<uint64>(Value[i]) - static_cast<uint64>(Previous));
+			Written += FLowEntryVarint::Write(Dest + Written, FLowEntryVarint::ZigZagEncode(Delta));
+			Previous = Value[i];
+		}
+		TrimRawBytes(Start + Written);
+	}
+}
@@ -0,0 +1,277 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryPixelOpChain.h"
+
+#include "Async/ParallelFor.h"
+
+#if PLATFORM_ALWAYS_HAS_SSE4_1
+	#include <smmintrin.h>
+	#define LOWENTRY_PIXEL_OP_SSE 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define LOWENTRY_PIXEL_OP_NEON 1
+#endif
+
+#ifndef LOWENTRY_PIXEL_OP_SSE
+	#define LOWENTRY_PIXEL_OP_SSE 0
+#endif
+#ifndef LOWENTRY_PIXEL_OP_NEON
+	#define LOWENTRY_PIXEL_OP_NEON 0
+#endif
+
+
+namespace LowEntryPixelOpChain
+{
+	/** The products of the grayscale formula, looked up instead of calculated, the sum is still done in doubles so the rounding is exactly the same as in GrayscalePixel. */
+	struct FGrayscaleTable
+	{
+		double R[256];
+		double G[256];
+		double B[256];
+
+		FGrayscaleTable()
+		{
+			for (int32 i = 0; i < 256; i++)
+			{
+				R[i] = 0.2125 * i;
+				G[i] = 0.7154 * i;
+				B[i] = 0.0721 * i;
+			}
+		}
+	};
+
+	const FGrayscaleTable& GetGrayscaleTable()
+	{
+		static const FGrayscaleTable Table;
+		return Table;
+	}
+
+	bool IsIdentity(const uint8 Shuffle[4], const uint8 Xor[4])
+	{
+		for (int32 i = 0; i < 4; i++)
+		{
+			if ((Shuffle[i] != i) || (Xor[i] != 0))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+
+FLowEntryPixelOpChain::FLowEntryPixelOpChain(const ELowEntryPixelOp Op)
+{
+	Add(Op);
+}
+
+FLowEntryPixelOpChain::FLowEntryPixelOpChain(const TArray<ELowEntryPixelOp>& Ops)
+{
+	for (const ELowEntryPixelOp Op : Ops)
+	{
+		Add(Op);
+	}
+}
+
+
+void FLowEntryPixelOpChain::Add(const ELowEntryPixelOp Op)
+{
+	if (Op == ELowEntryPixelOp::Grayscale)
+	{
+		FStage Stage;
+		Stage.Grayscale = true;
+		Stages.Add(Stage);
+		return;
+	}
+
+	if ((Stages.Num() <= 0) || Stages.Last().Grayscale)
+	{
+		Stages.Add(FStage());
+	}
+	FStage& Stage = Stages.Last();
+
+	const int32 R = STRUCT_OFFSET(FColor, R);
+	const int32 G = STRUCT_OFFSET(FColor, G);
+	const int32 B = STRUCT_OFFSET(FColor, B);
+	const int32 A = STRUCT_OFFSET(FColor, A);
+
+	int32 FlipA = -1;
+	int32 FlipB = -1;
+	switch (Op)
+	{
+	case ELowEntryPixelOp::FlipRedGreen:
+		FlipA = R;
+		FlipB = G;
+		break;
+	case ELowEntryPixelOp::FlipGreenBlue:
+		FlipA = G;
+		FlipB = B;
+		break;
+	case ELowEntryPixelOp::FlipRedBlue:
+		FlipA = R;
+		FlipB = B;
+		break;
+	case ELowEntryPixelOp::FlipRedAlpha:
+		FlipA = R;
+		FlipB = A;
+		break;
+	case ELowEntryPixelOp::FlipGreenAlpha:
+		FlipA = G;
+		FlipB = A;
+		break;
+	case ELowEntryPixelOp::FlipBlueAlpha:
+		FlipA = B;
+		FlipB = A;
+		break;
+	case ELowEntryPixelOp::InvertRed:
+		Stage.Xor[R] ^= 0xff;
+		break;
+	case ELowEntryPixelOp::InvertGreen:
+		Stage.Xor[G] ^= 0xff;
+		break;
+	case ELowEntryPixelOp::InvertBlue:
+		Stage.Xor[B] ^= 0xff;
+		break;
+	case ELowEntryPixelOp::InvertAlpha:
+		Stage.Xor[A] ^= 0xff;
+		break;
+	default:
+		break;
+	}
+
+	if (FlipA >= 0)
+	{
+		// the output byte FlipA now gets what the output byte FlipB would've gotten, and the other way around
+		Swap(Stage.Shuffle[FlipA], Stage.Shuffle[FlipB]);
+		Swap(Stage.Xor[FlipA], Stage.Xor[FlipB]);
+	}
+}
+
+bool FLowEntryPixelOpChain::IsEmpty() const
+{
+	for (const FStage& Stage : Stages)
+	{
+		if (Stage.Grayscale || !LowEntryPixelOpChain::IsIdentity(Stage.Shuffle, Stage.Xor))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void FLowEntryPixelOpChain::Apply(const FColor* Src, FColor* Dest, const int32 Count) const
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+	if (IsEmpty())
+	{
+		if (Src != Dest)
+		{
+			FMemory::Memcpy(Dest, Src, Count * sizeof(FColor));
+		}
+		return;
+	}
+
+	const int32 Chunks = ((Count - 1) / CHUNK_SIZE) + 1;
+	ParallelFor(Chunks, [this, Src, Dest, Count](const int32 i)
+	{
+		const int32 Start = i * CHUNK_SIZE;
+		ApplyChunk(Src + Start, Dest + Start, FMath::Min(CHUNK_SIZE, Count - Start));
+	}, (Count < PARALLEL_MIN_COUNT));
+}
+
+TArray<FColor> FLowEntryPixelOpChain::Apply(const TArray<FColor>& Pixels) const
+{
+	TArray<FColor> Result;
+	Result.SetNumUninitialized(Pixels.Num());
+	Apply(Pixels.GetData(), Result.GetData(), Pixels.Num());
+	return Result;
+}
+
+void FLowEntryPixelOpChain::ApplyInPlace(TArray<FColor>& Pixels) const
+{
+	Apply(Pixels.GetData(), Pixels.GetData(), Pixels.Num());
+}
+
+
+void FLowEntryPixelOpChain::ApplyChunk(const FColor* Src, FColor* Dest, const int32 Count) const
+{
+	const FColor* In = Src;
+	for (const FStage& Stage : Stages)
+	{
+		if (Stage.Grayscale)
+		{
+			ApplyGrayscale(In, Dest, Count);
+		}
+		else if (!LowEntryPixelOpChain::IsIdentity(Stage.Shuffle, Stage.Xor))
+		{
+			ApplyShuffle(Stage, In, Dest, Count);
+		}
+		else if (In != Dest)
+		{
+			FMemory::Memcpy(Dest, In, Count * sizeof(FColor));
+		}
+		In = Dest;
+	}
+}
+
+void FLowEntryPixelOpChain::ApplyShuffle(const FStage& Stage, const FColor* Src, FColor* Dest, const int32 Count)
+{
+	int32 i = 0;
+
+#if LOWENTRY_PIXEL_OP_SSE || LOWENTRY_PIXEL_OP_NEON
+	uint8 MaskBytes[16];
+	uint8 XorBytes[16];
+	for (int32 Pixel = 0; Pixel < 4; Pixel++)
+	{
+		for (int32 Byte = 0; Byte < 4; Byte++)
+		{
+			MaskBytes[(Pixel * 4) + Byte] = static_cast<uint8>((Pixel * 4) + Stage.Shuffle[Byte]);
+			XorBytes[(Pixel * 4) + Byte] = Stage.Xor[Byte];
+		}
+	}
+#endif
+
+#if LOWENTRY_PIXEL_OP_SSE
+	const __m128i Mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(MaskBytes));
+	const __m128i XorMask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(XorBytes));
+	for (; (i + 4) <= Count; i += 4)
+	{
+		const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + i), _mm_xor_si128(_mm_shuffle_epi8(Value, Mask), XorMask));
+	}
+#elif LOWENTRY_PIXEL_OP_NEON
+	const uint8x16_t Mask = vld1q_u8(MaskBytes);
+	const uint8x16_t XorMask = vld1q_u8(XorBytes);
+	for (; (i + 4) <= Count; i += 4)
+	{
+		const uint8x16_t Value = vld1q_u8(reinterpret_cast<const uint8*>(Src + i));
+		vst1q_u8(reinterpret_cast<uint8*>(Dest + i), veorq_u8(vqtbl1q_u8(Value, Mask), XorMask));
+	}
+#endif
+
+	for (; i < Count; i++)
+	{
+		const uint8* In = reinterpret_cast<const uint8*>(Src + i);
+		uint8 Out[4];
+		for (int32 Byte = 0; Byte < 4; Byte++)
+		{
+			Out[Byte] = In[Stage.Shuffle[Byte]] ^ Stage.Xor[Byte];
+		}
+		FMemory::Memcpy(Dest + i, Out, sizeof(FColor));
+	}
+}
+
+void FLowEntryPixelOpChain::ApplyGrayscale(const FColor* Src, FColor* Dest, const int32 Count)
+{
+	const LowEntryPixelOpChain::FGrayscaleTable& Table = LowEntryPixelOpChain::GetGrayscaleTable();
+	for (int32 i = 0; i < Count; i++)
+	{
+		const FColor Pixel = Src[i];
+		const uint8 Gray = static_cast<uint8>(FMath::RoundToDouble((Table.R[Pixel.R] + Table.G[Pixel.G]) + Table.B[Pixel.B]));
+		Dest[i] = FColor(Gray, Gray, Gray, Pixel.A);
+	}
+}
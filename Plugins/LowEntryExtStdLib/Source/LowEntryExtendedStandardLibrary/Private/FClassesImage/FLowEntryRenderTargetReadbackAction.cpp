@@ -0,0 +1,217 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#include "FLowEntryRenderTargetReadbackAction.h"
+
+#include "Async/Async.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "Misc/App.h"
+
+
+namespace LowEntryRenderTargetReadback
+{
+	/** The amount of staging buffers that are kept for reuse, when another one is given back the least recently given back one is released. */
+	const int32 MAX_POOLED_READBACKS = 4;
+
+	/** How long to wait for the GPU before giving up, so the latent node always continues (for example on RHIs that never signal the copy). */
+	const double TIMEOUT_SECONDS = 10.0;
+
+	/** A readback creates its staging buffer on the first copy and assumes the same size afterwards, so it can only be reused for render targets of the same size. */
+	struct FPooledReadback
+	{
+		FIntPoint Size;
+		TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> Readback;
+	};
+
+	FCriticalSection PoolLock;
+
+	/** Never destroyed, the RHI might already be gone when statics are destroyed on shutdown. */
+	TArray<FPooledReadback>& GetPool()
+	{
+		static TArray<FPooledReadback>* Pool = new TArray<FPooledReadback>();
+		return *Pool;
+	}
+}
+
+
+FLowEntryRenderTargetReadbackAction::FLowEntryRenderTargetReadbackAction(UTextureRenderTarget2D* TextureRenderTarget2D, FWork&& Work, TFunction<void()>&& Complete0, const FLatentActionInfo& LatentInfo)
+	: ExecutionFunction(LatentInfo.ExecutionFunction)
+	, OutputLink(LatentInfo.Linkage)
+	, CallbackTarget(LatentInfo.CallbackTarget)
+	, State(MakeShared<FState, ESPMode::ThreadSafe>())
+	, Complete(MoveTemp(Complete0))
+	, StartTime(FPlatformTime::Seconds())
+{
+	FTextureRenderTargetResource* Resource = ((TextureRenderTarget2D != nullptr) && FApp::CanEverRender()) ? TextureRenderTarget2D->GameThread_GetRenderTargetResource() : nullptr;
+	if (Resource == nullptr)
+	{
+		State->Finished = true;
+		return;
+	}
+
+	const FIntPoint Size = Resource->GetSizeXY();
+	State->Width = Size.X;
+	State->Height = Size.Y;
+	State->Work = MoveTemp(Work);
+	State->Readback = TakeReadback(Size);
+
+	TSharedRef<FState, ESPMode::ThreadSafe> CopyState = State;
+	ENQUEUE_RENDER_COMMAND(LowEntryRenderTargetReadbackCopy)([CopyState, Resource](FRHICommandListImmediate& RHICmdList)
+	{
+		FRHITexture* Texture = Resource->GetRenderTargetTexture();
+		if ((Texture == nullptr) || CopyState->Cancelled)
+		{
+			CopyState->Readback.Reset();
+			CopyState->Finished = true;
+			return;
+		}
+		CopyState->Readback->EnqueueCopy(RHICmdList, Texture);
+	});
+}
+
+FLowEntryRenderTargetReadbackAction::~FLowEntryRenderTargetReadbackAction()
+{
+	State->Cancelled = true;
+
+	// the staging buffer might still be in use by the GPU, so it has to be released on the render thread
+	TSharedRef<FState, ESPMode::ThreadSafe> ReleaseState = State;
+	ENQUEUE_RENDER_COMMAND(LowEntryRenderTargetReadbackRelease)([ReleaseState](FRHICommandListImmediate& RHICmdList)
+	{
+		ReleaseState->Readback.Reset();
+	});
+}
+
+
+void FLowEntryRenderTargetReadbackAction::UpdateOperation(FLatentResponse& Response)
+{
+	if (!State->Finished)
+	{
+		if ((FPlatformTime::Seconds() - StartTime) > LowEntryRenderTargetReadback::TIMEOUT_SECONDS)
+		{
+			// the worker and the render thread check this flag, the outputs stay empty
+			State->Cancelled = true;
+			Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+			return;
+		}
+		if (!State->Polling)
+		{
+			State->Polling = true;
+			TSharedRef<FState, ESPMode::ThreadSafe> PollState = State;
+			ENQUEUE_RENDER_COMMAND(LowEntryRenderTargetReadbackPoll)([PollState](FRHICommandListImmediate& RHICmdList)
+			{
+				Poll(PollState);
+			});
+		}
+		return;
+	}
+	if (!State->Cancelled && Complete)
+	{
+		Complete();
+	}
+	Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+}
+
+void FLowEntryRenderTargetReadbackAction::NotifyObjectDestroyed()
+{
+	State->Cancelled = true;
+}
+
+void FLowEntryRenderTargetReadbackAction::NotifyActionAborted()
+{
+	State->Cancelled = true;
+}
+
+#if WITH_EDITOR
+FString FLowEntryRenderTargetReadbackAction::GetDescription() const
+{
+	return State->Finished ? TEXT("Render Target Readback (done)") : TEXT("Render Target Readback (waiting for the GPU)");
+}
+#endif
+
+
+void FLowEntryRenderTargetReadbackAction::Poll(const TSharedRef<FState, ESPMode::ThreadSafe>& State)
+{
+	if (State->Cancelled || !State->Readback.IsValid())
+	{
+		State->Readback.Reset();
+		return;
+	}
+	if (!State->Readback->IsReady())
+	{
+		State->Polling = false;
+		return;
+	}
+
+	const int32 Width = State->Width;
+	const int32 Height = State->Height;
+	TArray<FColor> Pixels;
+
+	int32 RowPitchInPixels = 0;
+	int32 BufferHeight = 0;
+	const FColor* Data = static_cast<const FColor*>(State->Readback->Lock(RowPitchInPixels, &BufferHeight));
+	if ((Data != nullptr) && (RowPitchInPixels >= Width) && (BufferHeight >= Height))
+	{
+		// only the copy happens on the render thread, everything else is done on the thread pool
+		Pixels.SetNumUninitialized(Width * Height);
+		for (int32 y = 0; y < Height; y++)
+		{
+			FMemory::Memcpy(Pixels.GetData() + (y * Width), Data + (y * RowPitchInPixels), Width * sizeof(FColor));
+		}
+	}
+	State->Readback->Unlock();
+	GiveBackReadback(MoveTemp(State->Readback), FIntPoint(Width, Height));
+
+	if (Pixels.Num() <= 0)
+	{
+		State->Finished = true;
+		return;
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> TaskState = State;
+	Async(EAsyncExecution::ThreadPool, [TaskState, Width, Height, Pixels = MoveTemp(Pixels)]() mutable
+	{
+		if (!TaskState->Cancelled)
+		{
+			for (FColor& Pixel : Pixels)
+			{
+				Pixel.A = 255;
+			}
+			TaskState->Work(Width, Height, MoveTemp(Pixels));
+		}
+		TaskState->Finished = true;
+	});
+}
+
+
+TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> FLowEntryRenderTargetReadbackAction::TakeReadback(const FIntPoint& Size)
+{
+	{
+		FScopeLock Lock(&LowEntryRenderTargetReadback::PoolLock);
+		TArray<LowEntryRenderTargetReadback::FPooledReadback>& Pool = LowEntryRenderTargetReadback::GetPool();
+		for (int32 i = Pool.Num() - 1; i >= 0; i--)
+		{
+			if (Pool[i].Size == Size)
+			{
+				TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> Readback = MoveTemp(Pool[i].Readback);
+				Pool.RemoveAt(i, EAllowShrinking::No);
+				return Readback;
+			}
+		}
+	}
+	return MakeShared<FRHIGPUTextureReadback, ESPMode::ThreadSafe>(TEXT("LowEntryRenderTargetReadback"));
+}
+
+void FLowEntryRenderTargetReadbackAction::GiveBackReadback(TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe>&& Readback, const FIntPoint& Size)
+{
+	TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> Released = MoveTemp(Readback);
+	FScopeLock Lock(&LowEntryRenderTargetReadback::PoolLock);
+	TArray<LowEntryRenderTargetReadback::FPooledReadback>& Pool = LowEntryRenderTargetReadback::GetPool();
+	if (Pool.Num() >= LowEntryRenderTargetReadback::MAX_POOLED_READBACKS)
+	{
+		// the least recently returned one makes room, so that the pool follows the sizes that are currently being read back
+		Pool.RemoveAt(0, EAllowShrinking::No);
+	}
+	Pool.Add({Size, MoveTemp(Released)});
+}
@@ -0,0 +1,46 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryPixelOp.generated.h"
+
+
+UENUM(BlueprintType)
+enum class ELowEntryPixelOp : uint8
+{
+	/** Converts the pixels to accurate-looking gray pixels (like Grayscale Pixels) */
+	Grayscale,
+
+	/** Flips the red and green channels */
+	FlipRedGreen,
+
+	/** Flips the green and blue channels */
+	FlipGreenBlue,
+
+	/** Flips the red and blue channels */
+	FlipRedBlue,
+
+	/** Flips the red and alpha channels */
+	FlipRedAlpha,
+
+	/** Flips the green and alpha channels */
+	FlipGreenAlpha,
+
+	/** Flips the blue and alpha channels */
+	FlipBlueAlpha,
+
+	/** Inverts the red channel */
+	InvertRed,
+
+	/** Inverts the green channel */
+	InvertGreen,
+
+	/** Inverts the blue channel */
+	InvertBlue,
+
+	/** Inverts the alpha channel */
+	InvertAlpha
+};
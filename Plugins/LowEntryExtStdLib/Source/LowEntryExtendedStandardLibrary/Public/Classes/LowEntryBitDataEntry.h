@@ -7,6 +7,7 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "FLowEntryDataEntryValue.h"
 
 #include "LowEntryBitDataEntry.generated.h"
 
@@ -64,49 +65,21 @@ public:
 	UPROPERTY()
 	uint8 Type = 0;
 
+	/**
+	* The scalar, string or array value of this entry, depending on the type.
+	*/
+	FLowEntryDataEntryValue Storage;
 
-	UPROPERTY()
-	uint8 ByteValue;
-	UPROPERTY()
-	int32 IntegerValue;
-	UPROPERTY()
-	int64 LongValue;
-	UPROPERTY()
-	ULowEntryLong* LongBytesValue = nullptr;
-
-	UPROPERTY()
-	float FloatValue;
-	UPROPERTY()
-	double DoubleValue;
-	UPROPERTY()
-	ULowEntryDouble* DoubleBytesValue = nullptr;
-
-	UPROPERTY()
-	bool BooleanValue;
-	UPROPERTY()
-	FString StringUtf8Value;
+	/**
+	* The bit count of the Least Significant Bits and Most Significant Bits types.
+	*/
+	int32 BitCountValue = 0;
 
-
-	UPROPERTY()
-	TArray<uint8> ByteArrayValue;
-	UPROPERTY()
-	TArray<int32> IntegerArrayValue;
-	UPROPERTY()
-	TArray<int64> LongArrayValue;
-	UPROPERTY()
-	TArray<ULowEntryLong*> LongBytesArrayValue;
-
-	UPROPERTY()
-	TArray<float> FloatArrayValue;
-	UPROPERTY()
-	TArray<double> DoubleArrayValue;
-	UPROPERTY()
-	TArray<ULowEntryDouble*> DoubleBytesArrayValue;
-
-	UPROPERTY()
-	TArray<bool> BooleanArrayValue;
+	/**
+	* The Long Bytes or Double Bytes value(s) of this entry. These are kept in a single property, so the garbage collector only has one array to trace per entry. Emptied when the entry is set to any other type, so it doesn't keep old objects alive.
+	*/
 	UPROPERTY()
-	TArray<FString> StringUtf8ArrayValue;
+	TArray<UObject*> ObjectValues;
 
 
 public:
@@ -182,53 +155,53 @@ public:
 
 	bool IsStringUtf8();
 	void SetStringUtf8(const FString& Value);
-	FString GetStringUtf8();
+	const FString& GetStringUtf8();
 
 
 	bool IsBitArray();
 	void SetBitArray(const TArray<bool>& Value);
-	TArray<bool> GetBitArray();
+	const TArray<bool>& GetBitArray();
 
 	bool IsByteArrayLeastSignificantBits();
 	void SetByteArrayLeastSignificantBits(const TArray<uint8>& Value, const int32 BitCount);
-	TArray<uint8> GetByteArrayLeastSignificantBits();
+	const TArray<uint8>& GetByteArrayLeastSignificantBits();
 
 	bool IsByteArrayMostSignificantBits();
 	void SetByteArrayMostSignificantBits(const TArray<uint8>& Value, const int32 BitCount);
-	TArray<uint8> GetByteArrayMostSignificantBits();
+	const TArray<uint8>& GetByteArrayMostSignificantBits();
 
 	bool IsIntegerArrayLeastSignificantBits();
 	void SetIntegerArrayLeastSignificantBits(const TArray<int32>& Value, const int32 BitCount);
-	TArray<int32> GetIntegerArrayLeastSignificantBits();
+	const TArray<int32>& GetIntegerArrayLeastSignificantBits();
 
 	bool IsIntegerArrayMostSignificantBits();
 	void SetIntegerArrayMostSignificantBits(const TArray<int32>& Value, const int32 BitCount);
-	TArray<int32> GetIntegerArrayMostSignificantBits();
+	const TArray<int32>& GetIntegerArrayMostSignificantBits();
 
 
 	bool IsByteArray();
 	void SetByteArray(const TArray<uint8>& Value);
-	TArray<uint8> GetByteArray();
+	const TArray<uint8>& GetByteArray();
 
 	bool IsIntegerArray();
 	void SetIntegerArray(const TArray<int32>& Value);
-	TArray<int32> GetIntegerArray();
+	const TArray<int32>& GetIntegerArray();
 
 	bool IsPositiveInteger1Array();
 	void SetPositiveInteger1Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger1Array();
+	const TArray<int32>& GetPositiveInteger1Array();
 
 	bool IsPositiveInteger2Array();
 	void SetPositiveInteger2Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger2Array();
+	const TArray<int32>& GetPositiveInteger2Array();
 
 	bool IsPositiveInteger3Array();
 	void SetPositiveInteger3Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger3Array();
+	const TArray<int32>& GetPositiveInteger3Array();
 
 	bool IsLongArray();
 	void SetLongArray(const TArray<int64>& Value);
-	TArray<int64> GetLongArray();
+	const TArray<int64>& GetLongArray();
 
 	bool IsLongBytesArray();
 	void SetLongBytesArray(const TArray<ULowEntryLong*>& Value);
@@ -237,11 +210,11 @@ public:
 
 	bool IsFloatArray();
 	void SetFloatArray(const TArray<float>& Value);
-	TArray<float> GetFloatArray();
+	const TArray<float>& GetFloatArray();
 
 	bool IsDoubleArray();
 	void SetDoubleArray(const TArray<double>& Value);
-	TArray<double> GetDoubleArray();
+	const TArray<double>& GetDoubleArray();
 
 	bool IsDoubleBytesArray();
 	void SetDoubleBytesArray(const TArray<ULowEntryDouble*>& Value);
@@ -250,9 +223,9 @@ public:
 
 	bool IsBooleanArray();
 	void SetBooleanArray(const TArray<bool>& Value);
-	TArray<bool> GetBooleanArray();
+	const TArray<bool>& GetBooleanArray();
 
 	bool IsStringUtf8Array();
 	void SetStringUtf8Array(const TArray<FString>& Value);
-	TArray<FString> GetStringUtf8Array();
+	const TArray<FString>& GetStringUtf8Array();
 };
@@ -8,6 +8,8 @@
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
 
+#include "FLowEntryBitReader.h"
+
 #include "LowEntryBitDataReader.generated.h"
 
 
@@ -15,13 +17,10 @@ UCLASS(BlueprintType)
 class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBitDataReader : public UObject
 {
 	GENERATED_UCLASS_BODY()
-private:
-	const static uint8 mask[9];
-
-
 public:
 	static ULowEntryBitDataReader* Create(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 	static ULowEntryBitDataReader* CreateClone(const TArray<uint8>& Bytes, const int32 Position, const uint8 CurrentByte, const int32 CurrentBytePosition);
+	static ULowEntryBitDataReader* CreateClone(const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& SharedBytes, const FLowEntryBitReader& Reader);
 
 	int32 GetAndIncreasePosition(const int32 Increasement);
 	int32 MaxElementsRemaining(const int32 MinimumSizePerElement);
@@ -35,20 +34,17 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	int32 Position = 0;
-	UPROPERTY()
-	uint8 CurrentByte = 0;
-	UPROPERTY()
-	int32 CurrentBytePosition = 0;
+	// keeps the memory alive that Reader points to
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> SharedBytes;
+	FLowEntryBitReader Reader;
 
 
 	/**
 	* Clones the clone of this BitDataReader.
 	* 
 	* Allows you to easily read and revert the position (by cloning, reading data with the clone, and then throwing the clone away).
+	*
+	* The clone shares the byte data with this BitDataReader, so cloning is cheap no matter how much data there is.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader (Meta)", Meta = (DisplayName = "Get Clone"))
 	ULowEntryBitDataReader* GetClone();
@@ -198,6 +194,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get String (Utf 8)"))
 	FString GetStringUtf8();
 
+	/**
+	* Gets an integer that was added with Add Var Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get Var Integer"))
+	int32 GetVarInteger();
+
+	/**
+	* Gets a long that was added with Add Var Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get Var Long", Keywords = "int64 integer64 varint"))
+	int64 GetVarLong();
+
+	/**
+	* Gets an integer that was added with Add ZigZag Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get ZigZag Integer"))
+	int32 GetZigZagInteger();
+
+	/**
+	* Gets a long that was added with Add ZigZag Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get ZigZag Long", Keywords = "int64 integer64 varint"))
+	int64 GetZigZagLong();
+
 
 	/**
 	* Gets a bit array.
@@ -309,6 +329,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get String (Utf 8) Array"))
 	TArray<FString> GetStringUtf8Array();
 
+	/**
+	* Gets an integer array that was added with Add Integer Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get Integer Array (Delta)"))
+	TArray<int32> GetIntegerArrayDelta();
+
+	/**
+	* Gets a long array that was added with Add Long Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Reader", Meta = (DisplayName = "Get Long Array (Delta)", Keywords = "int64 integer64"))
+	TArray<int64> GetLongArrayDelta();
+
 
 	int32 SafeMultiply(const int32 A, const int32 B);
 };
@@ -8,6 +8,8 @@
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
 
+#include "FLowEntryBitWriter.h"
+
 #include "LowEntryBitDataWriter.generated.h"
 
 
@@ -18,10 +20,6 @@ UCLASS(BlueprintType)
 class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryBitDataWriter : public UObject
 {
 	GENERATED_UCLASS_BODY()
-private:
-	const static uint8 mask[9];
-
-
 public:
 	static ULowEntryBitDataWriter* Create();
 	static ULowEntryBitDataWriter* CreateFromEntryArray(const TArray<ULowEntryBitDataEntry*>& Array);
@@ -37,12 +35,7 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	uint8 CurrentByte = 0;
-	UPROPERTY()
-	int32 CurrentBytePosition = 0;
+	FLowEntryBitWriter Writer;
 
 
 	/**
@@ -185,6 +178,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add String (Utf 8)"))
 	void AddStringUtf8(const FString& Value);
 
+	/**
+	* Adds an integer, using 1 byte for values below 128, 2 bytes for values below 16.384, etc, up to 5 bytes.
+	*
+	* Negative values always take 5 bytes, use Add ZigZag Integer for values that can be negative.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add Var Integer"))
+	void AddVarInteger(const int32 Value);
+
+	/**
+	* Adds a long, using 1 byte for values below 128, 2 bytes for values below 16.384, etc, up to 10 bytes.
+	*
+	* Negative values always take 10 bytes, use Add ZigZag Long for values that can be negative.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add Var Long", Keywords = "int64 integer64 varint"))
+	void AddVarLong(const int64 Value);
+
+	/**
+	* Adds an integer, using 1 byte for values from -64 to 63, 2 bytes for values from -8.192 to 8.191, etc, up to 5 bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add ZigZag Integer"))
+	void AddZigZagInteger(const int32 Value);
+
+	/**
+	* Adds a long, using 1 byte for values from -64 to 63, 2 bytes for values from -8.192 to 8.191, etc, up to 10 bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add ZigZag Long", Keywords = "int64 integer64 varint"))
+	void AddZigZagLong(const int64 Value);
+
 
 	/**
 	* Adds a bit array.
@@ -319,4 +340,20 @@ public:
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add String (Utf 8) Array"))
 	void AddStringUtf8Array(const TArray<FString>& Value);
+
+	/**
+	* Adds an integer array, storing the difference with the previous value instead of the values themselves.
+	*
+	* Sorted or slowly changing values (timestamps, ids, etc) take about 1 byte per value.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add Integer Array (Delta)"))
+	void AddIntegerArrayDelta(const TArray<int32>& Value);
+
+	/**
+	* Adds a long array, storing the difference with the previous value instead of the values themselves.
+	*
+	* Sorted or slowly changing values (timestamps, ids, etc) take about 1 byte per value.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Bit Data|Writer", Meta = (DisplayName = "Add Long Array (Delta)", Keywords = "int64 integer64"))
+	void AddLongArrayDelta(const TArray<int64>& Value);
 };
@@ -7,6 +7,7 @@
 
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
+#include "FLowEntryDataEntryValue.h"
 
 #include "LowEntryByteDataEntry.generated.h"
 
@@ -52,49 +53,16 @@ public:
 	UPROPERTY()
 	uint8 Type = 0;
 
+	/**
+	* The scalar, string or array value of this entry, depending on the type.
+	*/
+	FLowEntryDataEntryValue Storage;
 
+	/**
+	* The Long Bytes or Double Bytes value(s) of this entry. These are kept in a single property, so the garbage collector only has one array to trace per entry. Emptied when the entry is set to any other type, so it doesn't keep old objects alive.
+	*/
 	UPROPERTY()
-	uint8 ByteValue;
-	UPROPERTY()
-	int32 IntegerValue;
-	UPROPERTY()
-	int64 LongValue;
-	UPROPERTY()
-	ULowEntryLong* LongBytesValue = nullptr;
-
-	UPROPERTY()
-	float FloatValue;
-	UPROPERTY()
-	double DoubleValue;
-	UPROPERTY()
-	ULowEntryDouble* DoubleBytesValue = nullptr;
-
-	UPROPERTY()
-	bool BooleanValue;
-	UPROPERTY()
-	FString StringUtf8Value;
-
-
-	UPROPERTY()
-	TArray<uint8> ByteArrayValue;
-	UPROPERTY()
-	TArray<int32> IntegerArrayValue;
-	UPROPERTY()
-	TArray<int64> LongArrayValue;
-	UPROPERTY()
-	TArray<ULowEntryLong*> LongBytesArrayValue;
-
-	UPROPERTY()
-	TArray<float> FloatArrayValue;
-	UPROPERTY()
-	TArray<double> DoubleArrayValue;
-	UPROPERTY()
-	TArray<ULowEntryDouble*> DoubleBytesArrayValue;
-
-	UPROPERTY()
-	TArray<bool> BooleanArrayValue;
-	UPROPERTY()
-	TArray<FString> StringUtf8ArrayValue;
+	TArray<UObject*> ObjectValues;
 
 
 public:
@@ -146,56 +114,68 @@ public:
 
 	bool IsStringUtf8();
 	void SetStringUtf8(const FString& Value);
-	FString GetStringUtf8();
+	const FString& GetStringUtf8();
 
 
 	bool IsByteArray();
 	void SetByteArray(const TArray<uint8>& Value);
-	TArray<uint8> GetByteArray();
+	void SetByteArray(TArray<uint8>&& Value);
+	const TArray<uint8>& GetByteArray();
 
 	bool IsIntegerArray();
 	void SetIntegerArray(const TArray<int32>& Value);
-	TArray<int32> GetIntegerArray();
+	void SetIntegerArray(TArray<int32>&& Value);
+	const TArray<int32>& GetIntegerArray();
 
 	bool IsPositiveInteger1Array();
 	void SetPositiveInteger1Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger1Array();
+	void SetPositiveInteger1Array(TArray<int32>&& Value);
+	const TArray<int32>& GetPositiveInteger1Array();
 
 	bool IsPositiveInteger2Array();
 	void SetPositiveInteger2Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger2Array();
+	void SetPositiveInteger2Array(TArray<int32>&& Value);
+	const TArray<int32>& GetPositiveInteger2Array();
 
 	bool IsPositiveInteger3Array();
 	void SetPositiveInteger3Array(const TArray<int32>& Value);
-	TArray<int32> GetPositiveInteger3Array();
+	void SetPositiveInteger3Array(TArray<int32>&& Value);
+	const TArray<int32>& GetPositiveInteger3Array();
 
 	bool IsLongArray();
 	void SetLongArray(const TArray<int64>& Value);
-	TArray<int64> GetLongArray();
+	void SetLongArray(TArray<int64>&& Value);
+	const TArray<int64>& GetLongArray();
 
 	bool IsLongBytesArray();
 	void SetLongBytesArray(const TArray<ULowEntryLong*>& Value);
+	void SetLongBytesArray(TArray<ULowEntryLong*>&& Value);
 	TArray<ULowEntryLong*> GetLongBytesArray();
 
 
 	bool IsFloatArray();
 	void SetFloatArray(const TArray<float>& Value);
-	TArray<float> GetFloatArray();
+	void SetFloatArray(TArray<float>&& Value);
+	const TArray<float>& GetFloatArray();
 
 	bool IsDoubleArray();
 	void SetDoubleArray(const TArray<double>& Value);
-	TArray<double> GetDoubleArray();
+	void SetDoubleArray(TArray<double>&& Value);
+	const TArray<double>& GetDoubleArray();
 
 	bool IsDoubleBytesArray();
 	void SetDoubleBytesArray(const TArray<ULowEntryDouble*>& Value);
+	void SetDoubleBytesArray(TArray<ULowEntryDouble*>&& Value);
 	TArray<ULowEntryDouble*> GetDoubleBytesArray();
 
 
 	bool IsBooleanArray();
 	void SetBooleanArray(const TArray<bool>& Value);
-	TArray<bool> GetBooleanArray();
+	void SetBooleanArray(TArray<bool>&& Value);
+	const TArray<bool>& GetBooleanArray();
 
 	bool IsStringUtf8Array();
 	void SetStringUtf8Array(const TArray<FString>& Value);
-	TArray<FString> GetStringUtf8Array();
+	void SetStringUtf8Array(TArray<FString>&& Value);
+	const TArray<FString>& GetStringUtf8Array();
 };
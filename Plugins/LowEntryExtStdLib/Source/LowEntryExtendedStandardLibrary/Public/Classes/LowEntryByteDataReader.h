@@ -8,6 +8,8 @@
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
 
+#include "FLowEntryByteReader.h"
+
 #include "LowEntryByteDataReader.generated.h"
 
 
@@ -17,7 +19,11 @@ class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataReader : public UObje
 	GENERATED_UCLASS_BODY()
 public:
 	static ULowEntryByteDataReader* Create(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+	static ULowEntryByteDataReader* CreateShared(const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+	static ULowEntryByteDataReader* CreateView(const TArrayView<const uint8>& Bytes);
+	static ULowEntryByteDataReader* CreateFromCompressed(const TArrayView<const uint8>& Bytes);
 	static ULowEntryByteDataReader* CreateClone(const TArray<uint8>& Bytes, const int32 Position);
+	static ULowEntryByteDataReader* CreateClone(const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& SharedBytes, const FLowEntryByteReader& Reader);
 
 	int32 GetAndIncreasePosition(const int32 Increasement);
 	int32 MaxElementsRemaining(const int32 MinimumSizePerElement);
@@ -28,16 +34,17 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
-	UPROPERTY()
-	int32 Position = 0;
+	// keeps the memory alive that Reader points to, is null when this reader is a view on memory that is owned by the caller
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> SharedBytes;
+	FLowEntryByteReader Reader;
 
 
 	/**
 	* Clones the clone of this ByteDataReader.
 	* 
 	* Allows you to easily read and revert the position (by cloning, reading data with the clone, and then throwing the clone away).
+	*
+	* The clone shares the byte data with this ByteDataReader, so cloning is cheap no matter how much data there is.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader (Meta)", Meta = (DisplayName = "Get Clone"))
 	ULowEntryByteDataReader* GetClone();
@@ -145,6 +152,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get String (Utf 8)"))
 	FString GetStringUtf8();
 
+	/**
+	* Gets an integer that was added with Add Var Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Var Integer"))
+	int32 GetVarInteger();
+
+	/**
+	* Gets a long that was added with Add Var Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Var Long", Keywords = "int64 integer64 varint"))
+	int64 GetVarLong();
+
+	/**
+	* Gets an integer that was added with Add ZigZag Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get ZigZag Integer"))
+	int32 GetZigZagInteger();
+
+	/**
+	* Gets a long that was added with Add ZigZag Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get ZigZag Long", Keywords = "int64 integer64 varint"))
+	int64 GetZigZagLong();
+
 
 	/**
 	* Gets a byte array.
@@ -218,6 +249,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get String (Utf 8) Array"))
 	TArray<FString> GetStringUtf8Array();
 
+	/**
+	* Gets an integer array that was added with Add Integer Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Integer Array (Delta)"))
+	TArray<int32> GetIntegerArrayDelta();
+
+	/**
+	* Gets a long array that was added with Add Long Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Get Long Array (Delta)", Keywords = "int64 integer64"))
+	TArray<int64> GetLongArrayDelta();
+
 
 	int32 SafeMultiply(const int32 A, const int32 B);
 };
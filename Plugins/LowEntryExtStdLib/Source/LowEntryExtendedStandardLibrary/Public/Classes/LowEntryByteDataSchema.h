@@ -0,0 +1,81 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryByteDataWriter.h"
+#include "LowEntryByteDataReader.h"
+
+#include "LowEntryByteDataSchema.generated.h"
+
+
+class ULowEntryByteDataEntry;
+
+
+/**
+* Describes the layout of a message (the types of its Byte Data Entries, in order).
+*
+* The layout is only looked at once, when the schema is created. Writing and reading a message after that doesn't need to figure out the type of every entry again, and reading fills in existing entries instead of creating new ones.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataSchema : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	typedef void (*FWriteOp)(ULowEntryByteDataWriter* Writer, ULowEntryByteDataEntry* Entry);
+	typedef void (*FReadOp)(ULowEntryByteDataReader* Reader, ULowEntryByteDataEntry* Entry);
+
+
+	static ULowEntryByteDataSchema* Create(const TArray<ULowEntryByteDataEntry*>& Layout);
+
+	/**
+	* Returns the function that writes the value of an entry with the same type as the given entry, returns a function that doesn't do anything if the entry is null or has no type.
+	*/
+	static FWriteOp GetWriteOp(ULowEntryByteDataEntry* Entry);
+
+	/**
+	* Returns the function that reads a value into an entry with the same type as the given entry, returns a function that doesn't do anything if the entry is null or has no type.
+	*/
+	static FReadOp GetReadOp(ULowEntryByteDataEntry* Entry);
+
+
+public:
+	TArray<FWriteOp> WriteOps;
+	TArray<FReadOp> ReadOps;
+
+	UPROPERTY()
+	ULowEntryByteDataWriter* CachedWriter = nullptr;
+
+
+	/**
+	* Returns the amount of entries a message of this schema consists of.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Byte Data|Schema", Meta = (DisplayName = "Get Entry Count"))
+	int32 GetEntryCount();
+
+	/**
+	* Adds the given entries to the given Byte Data Writer, using the types of the schema.
+	*
+	* The entries are expected to have the same types as the layout the schema was created with, an entry that is null is written as the default value of its type.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Schema", Meta = (DisplayName = "Write"))
+	void Write(ULowEntryByteDataWriter* ByteDataWriter, const TArray<ULowEntryByteDataEntry*>& Values);
+
+	/**
+	* Returns the bytes of the given entries, using the types of the schema.
+	*
+	* Reuses the same internal writer every time, so no Byte Data Writer has to be created for every message.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Schema", Meta = (DisplayName = "Get Bytes"))
+	TArray<uint8> GetBytes(const TArray<ULowEntryByteDataEntry*>& Values);
+
+	/**
+	* Reads a message from the given Byte Data Reader into the given entries, using the types of the schema.
+	*
+	* Entries that already exist are reused, only missing entries will be created. Passing the same array again for every message therefore doesn't create any new entries.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Schema", Meta = (DisplayName = "Read"))
+	void Read(ULowEntryByteDataReader* ByteDataReader, UPARAM(ref) TArray<ULowEntryByteDataEntry*>& Values);
+};
@@ -0,0 +1,258 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryLong.h"
+#include "LowEntryDouble.h"
+
+#include "FLowEntryByteStreamReader.h"
+
+#include "LowEntryByteDataStreamReader.generated.h"
+
+
+/**
+* Reads Byte Data from a file, without loading the whole file into memory.
+*
+* Reads the same data as the Byte Data Reader does, but only keeps a window of the file in memory, and reads the next part of the file in the background while the current part is being read.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataStreamReader : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryByteDataStreamReader* Create(TUniquePtr<FLowEntryByteStreamReader>&& Reader);
+	static ULowEntryByteDataStreamReader* OpenFile(const FString& FilePath, const int32 ChunkSize = FLowEntryByteStreamReader::DefaultChunkSize);
+	static ULowEntryByteDataStreamReader* OpenCompressedFile(const FString& FilePath, const int32 ChunkSize = FLowEntryByteStreamReader::DefaultChunkSize);
+
+	virtual void BeginDestroy() override;
+
+
+public:
+	// never null, is an empty reader when this Byte Data Stream Reader wasn't created from a file or an archive
+	TUniquePtr<FLowEntryByteStreamReader> Reader;
+
+
+	/**
+	* Returns the current position.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Get Position"))
+	int64 GetPosition();
+
+	/**
+	* Sets the current position.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Set Position"))
+	void SetPosition(const int64 Position_);
+
+	/**
+	* Sets the current position to 0.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Reset"))
+	void Reset();
+
+	/**
+	* Causes Remaining to return 0.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Empty"))
+	void Empty();
+
+	/**
+	* Returns the amount of bytes left.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Get Remaining"))
+	int64 Remaining();
+
+	/**
+	* Closes the file. After this, Remaining will return 0.
+	*
+	* The file is also closed automatically once this Byte Data Stream Reader is garbage collected, closing it yourself allows other code to open the file again sooner.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader (Meta)", Meta = (DisplayName = "Close"))
+	void Close();
+
+
+	/**
+	* Gets a byte.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Byte"))
+	uint8 GetByte();
+
+	/**
+	* Gets an integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Integer"))
+	int32 GetInteger();
+
+	/**
+	* Gets a positive integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 1"))
+	int32 GetPositiveInteger1();
+
+	/**
+	* Gets a positive integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 2"))
+	int32 GetPositiveInteger2();
+
+	/**
+	* Gets a positive integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 3"))
+	int32 GetPositiveInteger3();
+
+	/**
+	* Gets a long (int64).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Long", Keywords = "int64 integer64"))
+	int64 GetLong();
+
+	/**
+	* Gets a long (bytes).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Long (bytes)"))
+	ULowEntryLong* GetLongBytes();
+
+	/**
+	* Gets a float.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Float"))
+	float GetFloat();
+
+	/**
+	* Gets a double.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Double"))
+	double GetDouble();
+
+	/**
+	* Gets a double (bytes).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Double (bytes)"))
+	ULowEntryDouble* GetDoubleBytes();
+
+	/**
+	* Gets a boolean.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Boolean"))
+	bool GetBoolean();
+
+	/**
+	* Gets a String (UTF-8).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get String (Utf 8)"))
+	FString GetStringUtf8();
+
+	/**
+	* Gets an integer that was added with Add Var Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Var Integer"))
+	int32 GetVarInteger();
+
+	/**
+	* Gets a long that was added with Add Var Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Var Long", Keywords = "int64 integer64 varint"))
+	int64 GetVarLong();
+
+	/**
+	* Gets an integer that was added with Add ZigZag Integer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get ZigZag Integer"))
+	int32 GetZigZagInteger();
+
+	/**
+	* Gets a long that was added with Add ZigZag Long.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get ZigZag Long", Keywords = "int64 integer64 varint"))
+	int64 GetZigZagLong();
+
+
+	/**
+	* Gets a byte array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Byte Array"))
+	TArray<uint8> GetByteArray();
+
+	/**
+	* Gets an integer array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Integer Array"))
+	TArray<int32> GetIntegerArray();
+
+	/**
+	* Gets a positive integer array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 1 Array"))
+	TArray<int32> GetPositiveInteger1Array();
+
+	/**
+	* Gets a positive integer array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 2 Array"))
+	TArray<int32> GetPositiveInteger2Array();
+
+	/**
+	* Gets a positive integer array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Positive Integer 3 Array"))
+	TArray<int32> GetPositiveInteger3Array();
+
+	/**
+	* Gets a long (int64) array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Long Array", Keywords = "int64 integer64"))
+	TArray<int64> GetLongArray();
+
+	/**
+	* Gets a long (bytes) array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Long (bytes) Array"))
+	TArray<ULowEntryLong*> GetLongBytesArray();
+
+	/**
+	* Gets a float array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Float Array"))
+	TArray<float> GetFloatArray();
+
+	/**
+	* Gets a double array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Double Array"))
+	TArray<double> GetDoubleArray();
+
+	/**
+	* Gets a double (byte) array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Double (bytes) Array"))
+	TArray<ULowEntryDouble*> GetDoubleBytesArray();
+
+	/**
+	* Gets a boolean array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Boolean Array"))
+	TArray<bool> GetBooleanArray();
+
+	/**
+	* Gets a String (UTF-8) array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get String (Utf 8) Array"))
+	TArray<FString> GetStringUtf8Array();
+
+	/**
+	* Gets an integer array that was added with Add Integer Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Integer Array (Delta)"))
+	TArray<int32> GetIntegerArrayDelta();
+
+	/**
+	* Gets a long array that was added with Add Long Array (Delta).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Get Long Array (Delta)", Keywords = "int64 integer64"))
+	TArray<int64> GetLongArrayDelta();
+
+};
@@ -8,10 +8,13 @@
 #include "LowEntryLong.h"
 #include "LowEntryDouble.h"
 
+#include "FLowEntryByteWriter.h"
+
 #include "LowEntryByteDataWriter.generated.h"
 
 
 class ULowEntryByteDataEntry;
+class ULowEntryByteRope;
 
 
 UCLASS(BlueprintType)
@@ -21,6 +24,11 @@ class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteDataWriter : public UObje
 public:
 	static ULowEntryByteDataWriter* Create();
 	static ULowEntryByteDataWriter* CreateFromEntryArray(const TArray<ULowEntryByteDataEntry*>& Array);
+	static ULowEntryByteDataWriter* CreateStreaming(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink, const int32 ChunkSize = FLowEntryByteWriter::DefaultChunkSize);
+	static ULowEntryByteDataWriter* OpenFile(const FString& FilePath, const bool Append = false, const int32 ChunkSize = FLowEntryByteWriter::DefaultChunkSize);
+	static ULowEntryByteDataWriter* OpenCompressedFile(const FString& FilePath, const bool Append = false, const FName& Format = NAME_Oodle, const int32 ChunkSize = FLowEntryByteWriter::DefaultChunkSize);
+
+	virtual void BeginDestroy() override;
 
 	void AddRawByte(const uint8 Value);
 	void AddRawBytes(const TArray<uint8>& Value);
@@ -31,16 +39,44 @@ protected:
 
 
 public:
-	UPROPERTY()
-	TArray<uint8> Bytes;
+	FLowEntryByteWriter Writer;
 
 
-	/**
-	* Returns the byte data.
-	*/
 	/*UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Get Bytes"))*/
 	TArray<uint8> GetBytes();
 
+	/**
+	* Returns the byte data and empties this writer, without copying the bytes.
+	*
+	* When this writer writes to a file, this only returns the bytes that haven't been written to the file yet.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Take Bytes"))
+	TArray<uint8> TakeBytes();
+
+	/**
+	* Returns the byte data compressed (with Oodle) and empties this writer, the bytes can be read again with Create Byte Data Reader (Compressed).
+	*
+	* Data smaller than 256 bytes is stored uncompressed, with a header of 9 bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Take Compressed Bytes"))
+	TArray<uint8> TakeCompressedBytes();
+
+	/**
+	* Writes the remaining bytes to the file and waits until everything has been written.
+	*
+	* Returns false if writing failed. Does nothing (and returns true) when this writer doesn't write to a file.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Flush"))
+	bool Flush();
+
+	/**
+	* Reserves memory for the given amount of additional bytes.
+	*
+	* Doesn't change the byte data, it only prevents reallocations when you know beforehand (roughly) how many bytes are going to be added.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Reserve"))
+	void Reserve(const int32 ByteCount);
+
 
 	/**
 	* Adds a byte.
@@ -126,6 +162,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add String (Utf 8)"))
 	void AddStringUtf8(const FString& Value);
 
+	/**
+	* Adds an integer, using 1 byte for values below 128, 2 bytes for values below 16.384, etc, up to 5 bytes.
+	*
+	* Negative values always take 5 bytes, use Add ZigZag Integer for values that can be negative.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Var Integer"))
+	void AddVarInteger(const int32 Value);
+
+	/**
+	* Adds a long, using 1 byte for values below 128, 2 bytes for values below 16.384, etc, up to 10 bytes.
+	*
+	* Negative values always take 10 bytes, use Add ZigZag Long for values that can be negative.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Var Long", Keywords = "int64 integer64 varint"))
+	void AddVarLong(const int64 Value);
+
+	/**
+	* Adds an integer, using 1 byte for values from -64 to 63, 2 bytes for values from -8.192 to 8.191, etc, up to 5 bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add ZigZag Integer"))
+	void AddZigZagInteger(const int32 Value);
+
+	/**
+	* Adds a long, using 1 byte for values from -64 to 63, 2 bytes for values from -8.192 to 8.191, etc, up to 10 bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add ZigZag Long", Keywords = "int64 integer64 varint"))
+	void AddZigZagLong(const int64 Value);
+
 
 	/**
 	* Adds a byte array.
@@ -133,6 +197,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Byte Array"))
 	void AddByteArray(const TArray<uint8>& Value);
 
+	/**
+	* Adds the bytes of the given Byte Rope as a byte array, the fragments are copied into the writer directly, without merging them first.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Byte Array (Byte Rope)"))
+	void AddByteRope(ULowEntryByteRope* Value);
+
 	/**
 	* Adds an integer array.
 	*/
@@ -210,4 +280,20 @@ public:
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add String (Utf 8) Array"))
 	void AddStringUtf8Array(const TArray<FString>& Value);
+
+	/**
+	* Adds an integer array, storing the difference with the previous value instead of the values themselves.
+	*
+	* Sorted or slowly changing values (timestamps, ids, etc) take about 1 byte per value.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Integer Array (Delta)"))
+	void AddIntegerArrayDelta(const TArray<int32>& Value);
+
+	/**
+	* Adds a long array, storing the difference with the previous value instead of the values themselves.
+	*
+	* Sorted or slowly changing values (timestamps, ids, etc) take about 1 byte per value.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Add Long Array (Delta)", Keywords = "int64 integer64"))
+	void AddLongArrayDelta(const TArray<int64>& Value);
 };
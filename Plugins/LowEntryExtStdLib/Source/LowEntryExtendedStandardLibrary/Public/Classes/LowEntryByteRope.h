@@ -0,0 +1,82 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "FLowEntryByteChain.h"
+
+#include "LowEntryByteRope.generated.h"
+
+
+/**
+* Holds bytes in multiple fragments, so a message can be built from a header, a body and a trailer (in any order) without merging the bytes over and over again.
+*
+* Adding a Byte Rope to another Byte Rope doesn't copy any bytes, the bytes are only merged once, by Get Bytes.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryByteRope : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryByteRope* Create();
+	static ULowEntryByteRope* Create(FLowEntryByteChain&& Chain);
+
+
+public:
+	FLowEntryByteChain Chain;
+
+
+	/**
+	* Adds the given bytes to the end.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Append", AdvancedDisplay = "1"))
+	void Append(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Adds the given bytes to the start.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Prepend", AdvancedDisplay = "1"))
+	void Prepend(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Adds the bytes of the given Byte Rope to the end, without copying them.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Append Byte Rope"))
+	void AppendRope(ULowEntryByteRope* Rope);
+
+	/**
+	* Adds the bytes of the given Byte Rope to the start, without copying them.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Prepend Byte Rope"))
+	void PrependRope(ULowEntryByteRope* Rope);
+
+	/**
+	* Returns a new Byte Rope with the bytes of the given range, without copying them.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Slice"))
+	ULowEntryByteRope* Slice(const int32 Index, const int32 Length = 0x7FFFFFFF) const;
+
+	/**
+	* Returns all the bytes merged into one Byte Array.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Get Bytes"))
+	TArray<uint8> GetBytes() const;
+
+	/**
+	* Returns the total amount of bytes.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Length"))
+	int32 GetLength() const;
+
+	/**
+	* Removes all the bytes.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Clear"))
+	void Clear();
+};
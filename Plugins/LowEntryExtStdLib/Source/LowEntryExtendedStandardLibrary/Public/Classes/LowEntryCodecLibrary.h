@@ -0,0 +1,65 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+* Converts bytes to and from Base64, Base64Url, hex and binary strings.
+*
+* The characters are written directly into the resulting FString (or the bytes directly into the resulting array), there are no intermediate strings. Base64 and hex are done 16 bytes at a time with SSE where available.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryCodecLibrary
+{
+public:
+	/**
+	* Returns the Base64 (with padding) or Base64Url (without padding) of the given bytes.
+	*/
+	static FString EncodeBase64(const uint8* Bytes, const int32 Length, const bool Url);
+
+	/**
+	* Decodes the given Base64 or Base64Url, with or without padding. Url also accepts the standard Base64 characters, so it can decode both.
+	*
+	* Returns false if the given string isn't valid, Bytes is empty then.
+	*/
+	static bool DecodeBase64(const TCHAR* Chars, int32 Length, const bool Url, TArray<uint8>& Bytes);
+
+	/**
+	* Converts Base64 to Base64Url (removing the padding), or Base64Url to Base64 (without adding padding), in a single pass.
+	*/
+	static FString ConvertBase64(const FString& String, const bool ToUrl);
+
+
+	/**
+	* Returns the uppercase hex of the given bytes, optionally with a space between every byte.
+	*/
+	static FString EncodeHex(const uint8* Bytes, const int32 Length, const bool AddSpaces);
+
+	/**
+	* Decodes the given hex, spaces are ignored. If there is an odd amount of hex characters, the first character is decoded as a byte on its own.
+	*
+	* Returns false if the given string contains anything else than hex characters and spaces, Bytes is empty then.
+	*/
+	static bool DecodeHex(const TCHAR* Chars, const int32 Length, TArray<uint8>& Bytes);
+
+
+	/**
+	* Returns the bits of the given bytes as 0 and 1 characters, optionally with a space between every byte.
+	*
+	* The most significant bit of every byte comes first, unless LeastSignificantBitFirst is true.
+	*/
+	static FString EncodeBinary(const uint8* Bytes, const int32 Length, const bool AddSpaces, const bool LeastSignificantBitFirst);
+
+	/**
+	* Decodes the given 0 and 1 characters, spaces are ignored.
+	*
+	* Returns false if the given string contains anything else than 0, 1 and spaces, or if the amount of bits isn't a multiple of 8, Bytes is empty then.
+	*/
+	static bool DecodeBinary(const TCHAR* Chars, const int32 Length, const bool LeastSignificantBitFirst, TArray<uint8>& Bytes);
+
+
+protected:
+	static TCHAR* AllocateChars(FString& String, const int32 Length);
+};
@@ -27,6 +27,7 @@
 #include "ELowEntryBatteryState.h"
 
 #include "ELowEntryImageFormat.h"
+#include "ELowEntryPixelOp.h"
 
 #include "ELowEntryHmacAlgorithm.h"
 
@@ -52,12 +53,20 @@ class ULowEntryLatentActionString;
 class ULowEntryLatentActionStruct;
 
 class ULowEntryParsedHashcash;
+class ULowEntryHashcashSpentCache;
+
+class ULowEntrySha256Hasher;
+class ULowEntrySha512Hasher;
+class ULowEntryHmacContext;
 
 class ULowEntryByteArray;
+class ULowEntryByteRope;
 
 class ULowEntryByteDataEntry;
 class ULowEntryByteDataReader;
+class ULowEntryByteDataStreamReader;
 class ULowEntryByteDataWriter;
+class ULowEntryByteDataSchema;
 
 class ULowEntryBitDataEntry;
 class ULowEntryBitDataReader;
@@ -68,11 +77,21 @@ class ULowEntryDouble;
 
 class ULowEntryExecutionQueue;
 
+class ULowEntryTexturePool;
+
+class ULowEntryRegex;
+
+class IImageWrapperModule;
+
 
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FDelegateULowEntryExtendedStandardLibraryCompareObjects, UObject*, ObjectA, UObject*, ObjectB, bool&, Result);
 
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FDelegateULowEntryExtendedStandardLibraryCompareStructs, const FInstancedStruct&, StructA, const FInstancedStruct&, StructB, bool&, Result);
 
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateULowEntryExtendedStandardLibraryObjectSortKey, UObject*, Object, double&, Key);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FDelegateULowEntryExtendedStandardLibraryStructSortKey, const FInstancedStruct&, Struct, double&, Key);
+
 
 UCLASS()
 class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryExtendedStandardLibrary : public UBlueprintFunctionLibrary
@@ -465,7 +484,7 @@ public:
 	* Merges multiple Byte Arrays into one.
 	*/
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DeprecatedFunction, DeprecationMessage = "This function is commutative, meaning it sometimes causes bytes to be merged in an incorrect order. Use the new Merge Bytes node instead.", DisplayName = "Merge Bytes (commutative)", Keywords = "byte array", CommutativeAssociativeBinaryOperator = "true"))
-	static TArray<uint8> MergeBytes(TArray<uint8> A, TArray<uint8> B);
+	static TArray<uint8> MergeBytes(const TArray<uint8>& A, const TArray<uint8>& B);
 
 	/**
 	* Returns the values of the given bytes of the given index and length.
@@ -473,17 +492,29 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Get Bytes Sub Array", Keywords = "get byte array"))
 	static TArray<uint8> BytesSubArray(const TArray<uint8>& ByteArray, int32 Index, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Creates a new Byte Rope, which holds bytes in multiple fragments so that they only have to be merged once.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Byte Rope", Meta = (DisplayName = "Create Byte Rope", Keywords = "byte array chain buffer"))
+	static ULowEntryByteRope* ByteRope_Create();
+
 
 	/**
-	* Returns random bytes.
+	* Returns cryptographically secure random bytes, these can be used as salts, keys and nonces.
 	*/
-	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Generate Random Bytes", Keywords = "make create"))
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Generate Random Bytes", Keywords = "make create secure salt nonce"))
 	static void GenerateRandomBytes(const int32 Length, TArray<uint8>& ByteArray);
 
 	/**
-	* Returns random bytes.
+	* Returns random bytes that are much faster to generate, but which are not cryptographically secure, so they should never be used as salts, keys or nonces.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Generate Random Bytes (Fast)", Keywords = "make create"))
+	static void GenerateRandomBytesFast(const int32 Length, TArray<uint8>& ByteArray);
+
+	/**
+	* Returns cryptographically secure random bytes, the length is random as well.
 	*/
-	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Generate Random Bytes (Random Length)", Keywords = "make create"))
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Bytes", Meta = (DisplayName = "Generate Random Bytes (Random Length)", Keywords = "make create secure salt nonce"))
 	static void GenerateRandomBytesRandomLength(int32 MinLength, int32 MaxLength, TArray<uint8>& ByteArray);
 
 
@@ -811,6 +842,57 @@ public:
 	static void PixelsToBytes(const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
 
 
+	/**
+	* Converts a Byte Array into an image (Texture2D), the image is decoded on a background thread, the latent node continues once the texture is ready.
+	*
+	* If a Texture Pool is given, a texture of the same size is taken from the pool if it has one, its pixels are then updated in place instead of a new texture being created.
+	*
+	* Texture2D will be nullptr if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|From Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Bytes To Image (Texture2D) (Async)", Keywords = "byte array binary", AdvancedDisplay = "5"))
+	static void BytesToImageAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, UTexture2D*& Texture2D, ULowEntryTexturePool* TexturePool = nullptr, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Converts a Texture2D into a Byte Array, the pixels are read right away, the image is encoded on a background thread, the latent node continues once it's done.
+	*
+	* Some formats will not work (like BMP, ICO and ICNS).
+	*
+	* The Compression Quality has to be 1-100, a value of 0 will use the default value for the given ImageFormat.
+	*
+	* Returns an empty Byte Array if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|To Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Bytes (Texture2D) (Async)", Keywords = "byte array binary", AdvancedDisplay = "5"))
+	static void Texture2DToBytesAsync(UObject* WorldContextObject, UTexture2D* Texture2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
+
+	/**
+	* Converts a Byte Array into a Pixel Array, the image is decoded on a background thread, the latent node continues once it's done.
+	*
+	* Returns an empty Pixel Array if it fails, the Width and the Height will also be 0 then.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|From Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Bytes To Pixels (Async)", Keywords = "byte binary array width height pixels colors", AdvancedDisplay = "7"))
+	static void BytesToPixelsAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Converts a Pixel Array into a Byte Array, the image is encoded on a background thread, the latent node continues once it's done.
+	*
+	* Some formats will not work (like BMP, ICO and ICNS).
+	*
+	* The Compression Quality has to be 1-100, a value of 0 will use the default value for the given ImageFormat.
+	*
+	* Returns an empty Byte Array if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|To Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Pixels To Bytes (Async)", Keywords = "byte binary array width height pixels colors", AdvancedDisplay = "7"))
+	static void PixelsToBytesAsync(UObject* WorldContextObject, const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
+
+	/**
+	* Creates a new Texture Pool, which keeps textures that aren't used anymore so that they can be reused for new images of the same size.
+	*
+	* Give textures back to the pool once you don't need them anymore, Bytes To Image (Texture2D) (Async) can then reuse them.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|Texture Pool", Meta = (DisplayName = "Create Texture Pool"))
+	static ULowEntryTexturePool* TexturePool_Create(const int32 MaxTexturesPerSize = 4);
+
+
 	/**
 	* Converts the pixel to an accurate-looking gray pixel.
 	*
@@ -890,6 +972,23 @@ public:
 	static TArray<FColor> InvertPixelChannelA(const TArray<FColor>& Pixels);
 
 
+	/**
+	* Applies the given operations to the given pixels, in the given order, in a single pass over the pixels.
+	*
+	* This is a lot faster than calling Grayscale Pixels, Flip Pixel Channels and Invert Pixel Channel one after another, since no array is created in between and large images are processed on all cores.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Image|Other", Meta = (DisplayName = "Apply Pixel Operations", Keywords = "to convert make swap switch flip invert grayscale grey set color chain"))
+	static TArray<FColor> ApplyPixelOps(const TArray<FColor>& Pixels, const TArray<ELowEntryPixelOp>& Ops);
+
+	/**
+	* Applies the given operations to the given pixels, in the given order, in a single pass over the pixels.
+	*
+	* Changes the given Pixel Array directly instead of creating a new one, which is the fastest way to transform pixels.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|Other", Meta = (DisplayName = "Apply Pixel Operations (In Place)", Keywords = "to convert make swap switch flip invert grayscale grey set color chain"))
+	static void ApplyPixelOpsInPlace(UPARAM(ref) TArray<FColor>& Pixels, const TArray<ELowEntryPixelOp>& Ops);
+
+
 	/**
 	* Converts a Texture2D into a Pixel Array.
 	*
@@ -920,6 +1019,18 @@ public:
 	static UTexture2D* DataToTexture2D(int32 Width, int32 Height, const void* Src, SIZE_T Count);
 	static UTexture2D* DataToExistingTexture2D(UTexture2D* Texture2D, int32 Width, int32 Height, const void* Src, SIZE_T Count);
 
+	/**
+	* Puts the given BGRA data into the given texture if it has the same size, by updating its pixels in place on the render thread, instead of creating the texture on the GPU again. Creates a new texture otherwise.
+	*/
+	static UTexture2D* DataToExistingTexture2DStreamed(UTexture2D* Texture2D, int32 Width, int32 Height, TArray<uint8>&& Data);
+
+private:
+	static bool DecodeImage(IImageWrapperModule& ImageWrapperModule, const uint8* Data, const int64 Length, const ELowEntryImageFormat ImageFormat, int32& Width, int32& Height, TArray<uint8>& Uncompressed);
+	static TArray<FColor> BGRAToPixels(const int32 Width, const int32 Height, const TArray<uint8>& Uncompressed);
+	static TArray<uint8> EncodePixels(IImageWrapperModule& ImageWrapperModule, const int32 Width, const int32 Height, const TArray<FColor>& Pixels, const ELowEntryImageFormat ImageFormat, const int32 CompressionQuality);
+
+public:
+
 
 	/**
 	* Converts a SceneCapture2D into a Byte Array.
@@ -1009,6 +1120,81 @@ public:
 	static void TextureRenderTarget2DToPixels(UTextureRenderTarget2D* TextureRenderTarget2D, int32& Width, int32& Height, TArray<FColor>& Pixels);
 
 
+	/**
+	* Converts a SceneCapture2D into a Byte Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames, after which the image is encoded on a background thread. The latent node continues once the Byte Array is ready.
+	*
+	* The image is of the frame in which this node was called, this makes this suitable for taking screenshots repeatedly (like for a photo mode or for telemetry).
+	*
+	* Some formats will not work (like BMP, ICO and ICNS).
+	*
+	* The Compression Quality has to be 1-100, a value of 0 will use the default value for the given ImageFormat.
+	*
+	* Returns an empty Byte Array if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|To Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Bytes (SceneCapture2D) (Async)", Keywords = "byte array binary", AdvancedDisplay = "5"))
+	static void SceneCapture2DToBytesAsync(UObject* WorldContextObject, ASceneCapture2D* SceneCapture2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
+
+	/**
+	* Converts a SceneCaptureComponent2D into a Byte Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames, after which the image is encoded on a background thread. The latent node continues once the Byte Array is ready.
+	*
+	* Some formats will not work (like BMP, ICO and ICNS).
+	*
+	* The Compression Quality has to be 1-100, a value of 0 will use the default value for the given ImageFormat.
+	*
+	* Returns an empty Byte Array if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|To Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Bytes (SceneCaptureComponent2D) (Async)", Keywords = "byte array binary", AdvancedDisplay = "5"))
+	static void SceneCaptureComponent2DToBytesAsync(UObject* WorldContextObject, USceneCaptureComponent2D* SceneCaptureComponent2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
+
+	/**
+	* Converts a TextureRenderTarget2D into a Byte Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames, after which the image is encoded on a background thread. The latent node continues once the Byte Array is ready.
+	*
+	* Some formats will not work (like BMP, ICO and ICNS).
+	*
+	* The Compression Quality has to be 1-100, a value of 0 will use the default value for the given ImageFormat.
+	*
+	* Returns an empty Byte Array if it fails.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Encoding|To Bytes", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Bytes (TextureRenderTarget2D) (Async)", Keywords = "byte array binary", AdvancedDisplay = "5"))
+	static void TextureRenderTarget2DToBytesAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget2D, const ELowEntryImageFormat ImageFormat, FLatentActionInfo LatentInfo, TArray<uint8>& ByteArray, const int32 CompressionQuality = 0);
+
+	/**
+	* Converts a SceneCapture2D into a Pixel Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames. The latent node continues once the pixels are ready.
+	*
+	* Returns an empty Pixel Array if it fails, the Width and the Height will also be 0 then.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|To Pixels", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Pixels (SceneCapture2D) (Async)", Keywords = "array width height pixels colors"))
+	static void SceneCapture2DToPixelsAsync(UObject* WorldContextObject, ASceneCapture2D* SceneCapture2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels);
+
+	/**
+	* Converts a SceneCaptureComponent2D into a Pixel Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames. The latent node continues once the pixels are ready.
+	*
+	* Returns an empty Pixel Array if it fails, the Width and the Height will also be 0 then.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|To Pixels", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Pixels (SceneCaptureComponent2D) (Async)", Keywords = "bytearray width height pixels colors"))
+	static void SceneCaptureComponent2DToPixelsAsync(UObject* WorldContextObject, USceneCaptureComponent2D* SceneCaptureComponent2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels);
+
+	/**
+	* Converts a TextureRenderTarget2D into a Pixel Array, without stalling the game thread.
+	*
+	* The pixels are read back from the GPU in the background, which usually takes a few frames. The latent node continues once the pixels are ready.
+	*
+	* Returns an empty Pixel Array if it fails, the Width and the Height will also be 0 then.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|To Pixels", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Image To Pixels (TextureRenderTarget2D) (Async)", Keywords = "array width height pixels colors"))
+	static void TextureRenderTarget2DToPixelsAsync(UObject* WorldContextObject, UTextureRenderTarget2D* TextureRenderTarget2D, FLatentActionInfo LatentInfo, int32& Width, int32& Height, TArray<FColor>& Pixels);
+
+
 	/**
 	* Loads a video.
 	* 
@@ -1110,6 +1296,34 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Sha-512)", AdvancedDisplay = "1"))
 	static TArray<uint8> Sha512(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Generates a SHA-256 hash of the given file, always returns 32 bytes.
+	*
+	* The file is read in chunks, so even very large files never have to be fully loaded into memory.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash Of File (Sha-256)"))
+	static void Sha256File(const FString& FilePath, TArray<uint8>& Hash, bool& Success);
+
+	/**
+	* Generates a SHA-512 hash of the given file, always returns 64 bytes.
+	*
+	* The file is read in chunks, so even very large files never have to be fully loaded into memory.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash Of File (Sha-512)"))
+	static void Sha512File(const FString& FilePath, TArray<uint8>& Hash, bool& Success);
+
+	/**
+	* Creates a new SHA-256 Hasher, which can be given data in multiple parts before the hash is generated.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-256 Hasher", Meta = (DisplayName = "Create Sha-256 Hasher"))
+	static ULowEntrySha256Hasher* Sha256Hasher_Create();
+
+	/**
+	* Creates a new SHA-512 Hasher, which can be given data in multiple parts before the hash is generated.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-512 Hasher", Meta = (DisplayName = "Create Sha-512 Hasher"))
+	static ULowEntrySha512Hasher* Sha512Hasher_Create();
+
 	/**
 	* Generates a BCrypt hash, always returns 24 bytes.
 	* 
@@ -1125,6 +1339,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (DisplayName = "Generate Hash (Bcrypt)", AdvancedDisplay = "3"))
 	static TArray<uint8> BCrypt(const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, int32 Strength = 10, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Generates a BCrypt hash on a background thread, the latent node continues once it is done. Always returns 24 bytes.
+	*
+	* Works the same as Generate Hash (Bcrypt), except that it doesn't block the game thread, which matters for the higher strengths.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hash (Bcrypt) (Async)", AdvancedDisplay = "4"))
+	static void BCryptAsync(UObject* WorldContextObject, const TArray<uint8>& ByteArray, const TArray<uint8>& Salt, FLatentActionInfo LatentInfo, TArray<uint8>& Hash, int32 Strength = 10, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Generates a BCrypt hash of every given byte array on background threads, the latent node continues once all of them are done.
+	*
+	* Every byte array is hashed with the salt at the same index, the hashes are divided over all worker threads. Byte arrays without a valid salt result in an empty byte array.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hash (Bcrypt) (Array) (Async)"))
+	static void BCryptArrayAsync(UObject* WorldContextObject, const TArray<ULowEntryByteArray*>& ByteArrays, const TArray<ULowEntryByteArray*>& Salts, FLatentActionInfo LatentInfo, TArray<ULowEntryByteArray*>& Hashes, int32 Strength = 10);
+
 
 	/**
 	* Generates a HMAC hash.
@@ -1135,8 +1367,16 @@ public:
 	static TArray<uint8> HMAC(const TArray<uint8>& ByteArray, const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
 private:
-	static int32 HMAC_GetBlockSize(ELowEntryHmacAlgorithm Algorithm);
-	static TArray<uint8> HMAC_Hash(const TArray<uint8>& Array, ELowEntryHmacAlgorithm Algorithm);
+	static ELowEntryHmacAlgorithm HMAC_ValidateAlgorithm(ELowEntryHmacAlgorithm Algorithm);
+
+public:
+	/**
+	* Creates a new HMAC Context, which generates HMAC hashes with the given key.
+	*
+	* The key is only processed once, which makes this much faster than Generate Hash (HMAC) when many messages are signed or verified with the same key.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Create HMAC Context"))
+	static ULowEntryHmacContext* HmacContext_Create(const TArray<uint8>& Key, ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256);
 
 public:
 	/**
@@ -1211,6 +1451,46 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (DisplayName = "Generate Hashcash (Custom Creation Date)"))
 	static FString HashcashCustomCreationDate(const FString& Resource, const FDateTime& UtcDate, const int32 Bits = 22);
 
+	/**
+	* Creates Hashcash hashes on background threads, the latent node continues once all of them are done.
+	*
+	* Works the same as Generate Hashcash (Array), except that it doesn't block the game thread, the hashes are divided over all worker threads.
+	*
+	* The work is stopped as soon as possible when this node is aborted or the object that called it is destroyed.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hashcash (Array) (Async)"))
+	static void HashcashArrayAsync(UObject* WorldContextObject, const TArray<FString>& Resources, const int32 Bits, FLatentActionInfo LatentInfo, TArray<FString>& Hashes);
+
+	/**
+	* Creates Hashcash hashes on background threads, the latent node continues once all of them are done.
+	*
+	* Works the same as Generate Hashcash (Array) (Custom Creation Date), except that it doesn't block the game thread, the hashes are divided over all worker threads.
+	*
+	* The work is stopped as soon as possible when this node is aborted or the object that called it is destroyed.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hashcash (Array) (Custom Creation Date) (Async)"))
+	static void HashcashArrayCustomCreationDateAsync(UObject* WorldContextObject, const TArray<FString>& Resources, const FDateTime& UtcDate, const int32 Bits, FLatentActionInfo LatentInfo, TArray<FString>& Hashes);
+
+	/**
+	* Creates a Hashcash hash on background threads, the latent node continues once it is done.
+	*
+	* Works the same as Generate Hashcash, except that it doesn't block the game thread, the counters that are tried are divided over all worker threads, and they all stop as soon as one of them finds a valid hash.
+	*
+	* The work is stopped as soon as possible when this node is aborted or the object that called it is destroyed.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hashcash (Async)"))
+	static void HashcashAsync(UObject* WorldContextObject, const FString& Resource, const int32 Bits, FLatentActionInfo LatentInfo, FString& Hash);
+
+	/**
+	* Creates a Hashcash hash on background threads, the latent node continues once it is done.
+	*
+	* Works the same as Generate Hashcash (Custom Creation Date), except that it doesn't block the game thread, the counters that are tried are divided over all worker threads, and they all stop as soon as one of them finds a valid hash.
+	*
+	* The work is stopped as soon as possible when this node is aborted or the object that called it is destroyed.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Generate", Meta = (Latent, WorldContext = "WorldContextObject", LatentInfo = "LatentInfo", DisplayName = "Generate Hashcash (Custom Creation Date) (Async)"))
+	static void HashcashCustomCreationDateAsync(UObject* WorldContextObject, const FString& Resource, const FDateTime& UtcDate, const int32 Bits, FLatentActionInfo LatentInfo, FString& Hash);
+
 
 	/**
 	* Parses and validates a Hashcash hash.
@@ -1221,7 +1501,7 @@ public:
 	* 3) check if the amount of bits of the returned ParsedHashcashes are of a desired number
 	* 4) check if the resources of the returned ParsedHashcashes matches the expected string
 	* 5) check if the dates of the returned ParsedHashcashes are not in the future and are not too long ago
-	* 6) check if the hash hasn't been used already (save the used Hashcash hashes in an Array for example)
+	* 6) check if the hash hasn't been used already (a Hashcash Spent Cache can do this for you, as well as steps 1 to 5)
 	*
 	* You can change the order of actions if desired.
 	*/
@@ -1237,7 +1517,7 @@ public:
 	* 3) check if the amount of bits of the returned ParsedHashcash is of a desired number
 	* 4) check if the resource of the returned ParsedHashcash matches the expected string
 	* 5) check if the date of the returned ParsedHashcash is not in the future and is not too long ago
-	* 6) check if the hash hasn't been used already (save the used Hashcash hashes in an Array for example)
+	* 6) check if the hash hasn't been used already (a Hashcash Spent Cache can do this for you, as well as steps 1 to 5)
 	*
 	* You can change the order of actions if desired.
 	*/
@@ -1245,6 +1525,15 @@ public:
 	static ULowEntryParsedHashcash* HashcashParse(const FString& Hash);
 
 
+	/**
+	* Creates a new Hashcash Spent Cache, which verifies Hashcash hashes and refuses hashes that have been used before.
+	*
+	* Only hashes with a creation date that isn't older than MaxAgeSeconds, and isn't more than MaxFutureSeconds in the future, are accepted. Up to MaxEntries spent hashes are remembered, when more hashes are spent within the time window, the oldest ones are forgotten, and hashes that aren't newer than those will be refused from then on.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Spent Cache", Meta = (DisplayName = "Create Hashcash Spent Cache"))
+	static ULowEntryHashcashSpentCache* HashcashSpentCache_Create(const int32 MaxEntries = 100000, const int32 MaxAgeSeconds = 3600, const int32 MaxFutureSeconds = 300);
+
+
 	/**
 	* Returns true if this Parsed Hashcash is valid, returns false if it is not valid.
 	*/
@@ -1727,6 +2016,60 @@ public:
 	static void SortStructArrayDirectly(UPARAM(ref) TArray<FInstancedStruct>& StructArray, FDelegateULowEntryExtendedStandardLibraryCompareStructs Comparator, const bool Reversed = false);
 
 
+	/**
+	* Sorts a copy of the given array, by the key that the given Key Function returns for every object (for example the distance of an actor).
+	*
+	* This is a lot faster than sorting with a Comparator, since the Key Function is only called once for every object, instead of for every comparison. The objects are sorted from the lowest key to the highest key, objects with the same key keep their order.
+	*
+	* To create the Key Function, do this:
+	*  - create a function that has 1 input parameter (Object) and 1 output parameter (Float)
+	*  - it is important that the parameters have the following names: Object and Key
+	*  - then, when using the Sort By Key (Object Array) blueprint, use the Create Event blueprint and set its value as the function created earlier
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Array", Meta = (DisplayName = "Sort By Key (Object Array) (Copy)"))
+	static TArray<UObject*> SortObjectArrayByKey(const TArray<UObject*>& ObjectArray, FDelegateULowEntryExtendedStandardLibraryObjectSortKey KeyFunction, const bool Reversed = false);
+
+	/**
+	* Sorts the given array, by the key that the given Key Function returns for every object (for example the distance of an actor).
+	*
+	* This is a lot faster than sorting with a Comparator, since the Key Function is only called once for every object, instead of for every comparison. The objects are sorted from the lowest key to the highest key, objects with the same key keep their order.
+	*
+	* To create the Key Function, do this:
+	*  - create a function that has 1 input parameter (Object) and 1 output parameter (Float)
+	*  - it is important that the parameters have the following names: Object and Key
+	*  - then, when using the Sort By Key (Object Array) blueprint, use the Create Event blueprint and set its value as the function created earlier
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Array", Meta = (DisplayName = "Sort By Key (Object Array)"))
+	static void SortObjectArrayByKeyDirectly(UPARAM(ref) TArray<UObject*>& ObjectArray, FDelegateULowEntryExtendedStandardLibraryObjectSortKey KeyFunction, const bool Reversed = false);
+
+
+	/**
+	* Sorts a copy of the given array, by the key that the given Key Function returns for every struct.
+	*
+	* This is a lot faster than sorting with a Comparator, since the Key Function is only called once for every struct, instead of for every comparison. The structs are sorted from the lowest key to the highest key, structs with the same key keep their order.
+	*
+	* To create the Key Function, do this:
+	*  - create a function that has 1 input parameter (InstancedStruct) and 1 output parameter (Float)
+	*  - it is important that the parameters have the following names: Struct and Key
+	*  - then, when using the Sort By Key (Struct Array) blueprint, use the Create Event blueprint and set its value as the function created earlier
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|Array", Meta = (DisplayName = "Sort By Key (Struct Array) (Copy)"))
+	static TArray<FInstancedStruct> SortStructArrayByKey(const TArray<FInstancedStruct>& StructArray, FDelegateULowEntryExtendedStandardLibraryStructSortKey KeyFunction, const bool Reversed = false);
+
+	/**
+	* Sorts the given array, by the key that the given Key Function returns for every struct.
+	*
+	* This is a lot faster than sorting with a Comparator, since the Key Function is only called once for every struct, instead of for every comparison. The structs are sorted from the lowest key to the highest key, structs with the same key keep their order.
+	*
+	* To create the Key Function, do this:
+	*  - create a function that has 1 input parameter (InstancedStruct) and 1 output parameter (Float)
+	*  - it is important that the parameters have the following names: Struct and Key
+	*  - then, when using the Sort By Key (Struct Array) blueprint, use the Create Event blueprint and set its value as the function created earlier
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|Array", Meta = (DisplayName = "Sort By Key (Struct Array)"))
+	static void SortStructArrayByKeyDirectly(UPARAM(ref) TArray<FInstancedStruct>& StructArray, FDelegateULowEntryExtendedStandardLibraryStructSortKey KeyFunction, const bool Reversed = false);
+
+
 	/**
 	* Perform a latent action with a random delay (specified in seconds).  Calling again while it is counting down will be ignored.
 	*
@@ -1848,12 +2191,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|String", Meta = (DisplayName = "Regex Get Matches"))
 	static TArray<FLowEntryRegexMatch> RegexGetMatches(const FString& String, const FString& Pattern);
 
+	/**
+	* Returns the begin index and end index of each regex match (including each capture group of the regex) found in the given String, the matched strings are left empty.
+	*
+	* This is faster than Regex Get Matches, since no strings are created. Use "Regex Match To String" or "Regex Capture Group To String" to get the strings of the matches you need.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|String", Meta = (DisplayName = "Regex Get Match Offsets"))
+	static TArray<FLowEntryRegexMatch> RegexGetMatchOffsets(const FString& String, const FString& Pattern);
+
 	/**
 	* Replaces every regex match with the given replacement String.
 	*/
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String", Meta = (DisplayName = "Regex Replace"))
 	static FString RegexReplace(const FString& String, const FString& Pattern, const FString& Replacement);
 
+	/**
+	* Returns the matched string of the given regex match, the String has to be the same String the match was found in.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String", Meta = (DisplayName = "Regex Match To String"))
+	static FString RegexMatchToString(const FString& String, const FLowEntryRegexMatch& Match);
+
+	/**
+	* Returns the matched string of the given regex capture group, the String has to be the same String the match was found in.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String", Meta = (DisplayName = "Regex Capture Group To String"))
+	static FString RegexCaptureGroupToString(const FString& String, const FLowEntryRegexCaptureGroup& CaptureGroup);
+
+	/**
+	* Creates a compiled regex, which only compiles the pattern once, instead of every time it's used.
+	*
+	* The other Regex blueprints also keep the most recently used patterns compiled, but keeping a Regex around for patterns that are used often avoids looking up the pattern every time.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Create Regex"))
+	static ULowEntryRegex* Regex_Create(const FString& Pattern);
+
 
 	/**
 	* Causes a crash.
@@ -1906,6 +2277,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Create Byte Data Reader", AdvancedDisplay = "1"))
 	static ULowEntryByteDataReader* ByteDataReader_Create(const TArray<uint8>& Bytes, int32 Index = 0, int32 Length = 0x7FFFFFFF);
 
+	/**
+	* Creates a new Byte Data Reader from bytes that were returned by Take Compressed Bytes.
+	*
+	* Success will be false if the bytes are incomplete or corrupt.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Reader", Meta = (DisplayName = "Create Byte Data Reader (Compressed)"))
+	static ULowEntryByteDataReader* ByteDataReader_CreateFromCompressed(const TArray<uint8>& Bytes, bool& Success);
+
+	/**
+	* Opens a file as a Byte Data Stream Reader, which reads the Byte Data of the file without loading the whole file into memory.
+	*
+	* Success will be false if the file couldn't be opened.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Open Byte Data Stream Reader (File)"))
+	static ULowEntryByteDataStreamReader* ByteDataStreamReader_OpenFile(const FString& FilePath, bool& Success);
+
+	/**
+	* Opens a file that was written with Open Byte Data Writer (Compressed File) as a Byte Data Stream Reader, the data is decompressed while it's being read.
+	*
+	* Success will be false if the file couldn't be opened, or if it is damaged (contains a corrupt or incomplete frame).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Stream Reader", Meta = (DisplayName = "Open Byte Data Stream Reader (Compressed File)"))
+	static ULowEntryByteDataStreamReader* ByteDataStreamReader_OpenCompressedFile(const FString& FilePath, bool& Success);
+
 
 	/**
 	* Creates a new Byte Data Writer.
@@ -1925,6 +2320,30 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Create Byte Data Writer (Byte Data Entry Array) (Pure)"))
 	static ULowEntryByteDataWriter* ByteDataWriter_CreateFromEntryArrayPure(const TArray<ULowEntryByteDataEntry*>& Array);
 
+	/**
+	* Opens a file as a Byte Data Writer, which writes the bytes to the file in chunks as they are added, instead of keeping all of them in memory.
+	*
+	* Call Flush once done, to make sure everything has been written. Success will be false if the file couldn't be opened.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Open Byte Data Writer (File)"))
+	static ULowEntryByteDataWriter* ByteDataWriter_OpenFile(const FString& FilePath, const bool Append, bool& Success);
+
+	/**
+	* Opens a file as a Byte Data Writer that compresses the bytes (with Oodle) before writing them to the file, in chunks as they are added.
+	*
+	* Call Flush once done, to make sure everything has been written. Success will be false if the file couldn't be opened.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Writer", Meta = (DisplayName = "Open Byte Data Writer (Compressed File)"))
+	static ULowEntryByteDataWriter* ByteDataWriter_OpenCompressedFile(const FString& FilePath, const bool Append, bool& Success);
+
+	/**
+	* Creates a new Byte Data Schema, which remembers the types of the given entries.
+	*
+	* Use this when the same kind of message is written or read many times, the schema can then write and read it without having to check the type of every entry again.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Byte Data|Schema", Meta = (DisplayName = "Create Byte Data Schema"))
+	static ULowEntryByteDataSchema* ByteDataSchema_Create(const TArray<ULowEntryByteDataEntry*>& Layout);
+
 	/**
 	* Returns the byte data.
 	*/
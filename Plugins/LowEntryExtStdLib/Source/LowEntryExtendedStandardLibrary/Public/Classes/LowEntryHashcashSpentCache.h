@@ -0,0 +1,98 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+
+#include "LowEntryHashingHashcashLibrary.h"
+
+#include "LowEntryHashcashSpentCache.generated.h"
+
+
+/**
+* Verifies Hashcash hashes and remembers the ones that have been spent already, so the same hash can't be used twice.
+*
+* Only hashes created within the time window are accepted, so a spent hash only has to be remembered until it would have expired anyway. When the cache is full, the hashes with the oldest creation dates are forgotten first, and from then on every hash that isn't newer than those is refused, since there is no way to tell anymore whether it was spent already.
+*
+* Can be used from multiple threads at the same time.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHashcashSpentCache : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHashcashSpentCache* Create(const int32 MaxEntries, const int32 MaxAgeSeconds, const int32 MaxFutureSeconds);
+
+
+protected:
+	struct FSpentEntry
+	{
+		FDateTime Date;
+		FSHAHash Hash;
+	};
+
+
+public:
+	int32 MaxEntries = 1;
+	FTimespan MaxAge;
+	FTimespan MaxFuture;
+
+
+protected:
+	FCriticalSection Lock;
+	TSet<FSHAHash> Spent;
+
+	/** A min-heap on date, the top is always the entry that expires first. */
+	TArray<FSpentEntry> Entries;
+
+	/** Hashes created on or before this date are refused, since some of them might have been forgotten already. */
+	FDateTime OldestAccepted = FDateTime(0);
+
+
+public:
+	/**
+	* Returns true if the given parsed hashcash is valid, has been created within the time window, and hasn't been spent before. Marks it as spent if so.
+	*
+	* Doesn't check the resource and the bits, that's up to the caller.
+	*/
+	bool Spend(const FLowEntryHashcashData& Data, const FDateTime& UtcNow);
+
+
+	/**
+	* Returns true if the given Hashcash hash is valid, is for the given resource, has at least the given amount of bits, has been created within the time window, and hasn't been spent before.
+	*
+	* Marks the hash as spent if true is returned, so the same hash will be refused the next time.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Spent Cache", Meta = (DisplayName = "Verify"))
+	bool Verify(const FString& Hash, const FString& Resource, const int32 MinBits = 22);
+
+	/**
+	* Does the same as Verify for every given Hashcash hash, returns an array with a boolean for every hash.
+	*
+	* The hashes are parsed and checked on all worker threads, which makes this much faster than verifying the hashes one by one. If the same hash is given multiple times, only the first one is accepted.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Spent Cache", Meta = (DisplayName = "Verify (Array)"))
+	TArray<bool> VerifyArray(const TArray<FString>& Hashes, const FString& Resource, const int32 MinBits = 22);
+
+	/**
+	* Returns the amount of spent hashes that are currently remembered.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Hashcash|Spent Cache", Meta = (DisplayName = "Get Count"))
+	int32 GetCount();
+
+	/**
+	* Forgets all spent hashes.
+	*
+	* PS: this makes it possible to use the hashes that were already spent again.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashcash|Spent Cache", Meta = (DisplayName = "Clear"))
+	void Clear();
+
+
+protected:
+	void RemoveExpired(const FDateTime& UtcNow);
+	void RemoveOldest();
+};
@@ -5,6 +5,8 @@
 
 #include "CoreMinimal.h"
 
+#include "HAL/ThreadSafeBool.h"
+
 
 class ULowEntryHashingBCryptLibrary
 {
@@ -26,21 +28,25 @@ private:
 	int32 P[18] = {};
 	int32 S[1024] = {};
 
-	int32 nk = 0;
-	int32 nr = 0;
-	TArray<TArray<uint8>> w;
-
 
 private:
 	void encipher(int32 lr[], const int32 off);
 	static int32 streamtoword(const TArray<uint8>& data, int32 offp[]);
+	static void streamtowords(const TArray<uint8>& data, int32 words[]);
 	void init_key();
-	void key(const TArray<uint8>& key);
-	void ekskey(const TArray<uint8>& data, const TArray<uint8>& key);
+	void key(const int32 keywords[]);
+	void ekskey(const TArray<uint8>& data, const int32 keywords[]);
 	TArray<uint8> crypt_raw(const TArray<uint8>& password, const TArray<uint8>& salt, const int32 log_rounds, int32 cdata[]);
 	TArray<uint8> crypt_raw(const TArray<uint8>& password, const TArray<uint8>& salt, const int32 log_rounds);
 
 
 public:
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, const TArray<uint8>& Salt, const int32 Strength);
+
+	/**
+	* Hashes every given byte array with the salt at the same index, spread over all worker threads. Blocks till all of them are done.
+	*
+	* Byte arrays without a salt, and byte arrays that weren't hashed yet when the given cancelled flag became true, result in an empty byte array.
+	*/
+	static TArray<TArray<uint8>> HashArray(const TArray<TArray<uint8>>& Bytes, const TArray<TArray<uint8>>& Salts, const int32 Strength, const FThreadSafeBool* Cancelled);
 };
@@ -5,19 +5,39 @@
 
 #include "CoreMinimal.h"
 
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/SecureHash.h"
+
 #include "LowEntryParsedHashcash.h"
 
 
+/**
+* The parsed contents of a hashcash, without creating any UObjects, so it can be created on any thread.
+*/
+struct FLowEntryHashcashData
+{
+	bool Valid = false;
+	FString Resource;
+	FDateTime Date = FDateTime(0);
+	int32 Bits = 0;
+
+	/**
+	* The SHA-1 hash of the whole hashcash string.
+	*/
+	FSHAHash Hash;
+};
+
+
 class ULowEntryHashingHashcashLibrary
 {
 private:
 	constexpr static int32 VERSION = 1;
 	constexpr static int32 MAX_COUNTER = 1048576;
+	constexpr static int32 CANCEL_CHECK_INTERVAL = 1024;
+	constexpr static int32 PARALLEL_PARSE_MIN_COUNT = 64;
 
 	const static FString DATE_FORMAT_STRING;
 
-	static TArray<TArray<uint8>> BASE_64_CACHE;
-
 
 public:
 	static TArray<FString> hashArray(const TArray<FString>& resource, const int32 bits);
@@ -28,12 +48,37 @@ public:
 	static TArray<ULowEntryParsedHashcash*> parseArray(const TArray<FString>& Hashcashes);
 	static ULowEntryParsedHashcash* parse(const FString& Hashcash);
 
+	/**
+	* Parses the given hashcashes, spread over all worker threads. Blocks till all of them are done.
+	*/
+	static TArray<FLowEntryHashcashData> parseDataArray(const TArray<FString>& Hashcashes);
+	static FLowEntryHashcashData parseData(const FString& Hashcash);
+
+	/**
+	* Creates the hashcashes of the given resources, spread over all worker threads. Blocks till all of them are done.
+	*
+	* If the given cancelled flag becomes true, it stops as soon as possible, the hashcashes that weren't finished yet will be empty strings.
+	*/
+	static TArray<FString> hashArrayParallel(const TArray<FString>& resources, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled);
+
+	/**
+	* Creates the hashcash of the given resource, the counters are split over all worker threads, and the search stops as soon as any of them finds a valid one. Blocks till it is done.
+	*
+	* Returns an empty string if the given cancelled flag became true before it was done.
+	*/
+	static FString hashParallel(const FString& resource, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled);
+
 
 private:
+	static const TArray<TArray<uint8>>& getBase64Cache();
 	static TArray<TArray<uint8>> GenerateBase64Cache();
+	static FString hashSingleThreaded(const FString& resource, const FDateTime& date, const int32 bits, const FThreadSafeBool* cancelled);
+	static TArray<uint8> getDataPrefixBytes(const FString& resource, const FDateTime& date, const int32 bits);
+	static TArray<uint8> getRandomizedBuffer(const TArray<uint8>& dataPrefixBytes);
+	static int32 getWorkerCount();
 	static TArray<uint8> base64WithoutLeadingZeroBytes(const int32 value);
 	static FString getDateString(const FDateTime& date);
 	static FDateTime parseDateString(const FString& date);
-	FORCEINLINE static int32 countLeadingZeroBits(const TArray<uint8>& values);
+	FORCEINLINE static int32 countLeadingZeroBits(const uint8* values, const int32 length);
 	FORCEINLINE static uint8 countLeadingZeroBits(const uint8 v);
 };
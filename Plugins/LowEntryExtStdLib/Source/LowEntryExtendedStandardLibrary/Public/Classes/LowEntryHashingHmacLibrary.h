@@ -0,0 +1,96 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Misc/SecureHash.h"
+#include "Misc/TVariant.h"
+
+#include "ELowEntryHmacAlgorithm.h"
+#include "LowEntryHashingSha256Library.h"
+#include "LowEntryHashingSha512Library.h"
+
+
+/**
+* Generates HMAC hashes with a key that is only processed once.
+*
+* The padded key is absorbed into the inner and outer hash states once, when the key is set. Every hash after that starts from copies of those states, so the key doesn't have to be padded and hashed again for every message, and the message is never copied.
+*/
+class ULowEntryHashingHmacLibrary
+{
+private:
+	/** Only holds the hasher of the selected algorithm, so that copying a keyed state doesn't copy the others as well (empty for SHA-1, see Sha1). */
+	typedef TVariant<FEmptyVariantState, FMD5, ULowEntryHashingSha256Library, ULowEntryHashingSha512Library> FHashState;
+
+
+private:
+	ELowEntryHmacAlgorithm Algorithm = ELowEntryHmacAlgorithm::SHA256;
+
+	FHashState KeyedInner;
+	FHashState KeyedOuter;
+	FHashState Inner;
+
+	// FSHA1 keeps a pointer into itself, so it can't be copied, SHA-1 absorbs the cached padded keys again instead
+	FSHA1 Sha1;
+	TArray<uint8> InnerKeyPad;
+	TArray<uint8> OuterKeyPad;
+
+
+private:
+	FHashState createState() const;
+	void update(FHashState& State, const uint8* Bytes, const int64 Length);
+	TArray<uint8> digest(FHashState& State);
+	void startSha1Inner();
+
+
+public:
+	/**
+	* Creates a HMAC hasher with an empty key, use SetKey() to give it a key.
+	*/
+	ULowEntryHashingHmacLibrary();
+	ULowEntryHashingHmacLibrary(const uint8* Key, const int64 KeyLength, const ELowEntryHmacAlgorithm Algorithm0);
+
+	/**
+	* Sets the key and the algorithm, throwing away all the data given so far.
+	*/
+	void SetKey(const uint8* Key, const int64 KeyLength, const ELowEntryHmacAlgorithm Algorithm0);
+
+	/**
+	* Adds the given bytes to the message that is being hashed, can be called any amount of times.
+	*/
+	void Update(const uint8* Bytes, const int64 Length);
+
+	/**
+	* Returns the HMAC hash of all the data given so far, the hasher is reset afterwards so it can be used again with the same key.
+	*/
+	TArray<uint8> Final();
+
+	/**
+	* Resets the hasher, throwing away all the data given so far, the key is kept.
+	*/
+	void Reset();
+
+	/**
+	* Returns the HMAC hash of the given bytes, throws away any data that was given with Update() before.
+	*/
+	TArray<uint8> Sign(const uint8* Bytes, const int64 Length);
+
+	/**
+	* Returns true if the given hash is the HMAC hash of the given bytes, throws away any data that was given with Update() before.
+	*
+	* The hashes are compared in constant time, so the time it takes doesn't reveal how many bytes of the given hash were correct.
+	*/
+	bool Verify(const uint8* Bytes, const int64 Length, const uint8* Hash, const int64 HashLength);
+
+
+public:
+	static int32 GetBlockSize(const ELowEntryHmacAlgorithm Algorithm);
+	static TArray<uint8> Hash(const uint8* Bytes, const int64 Length, const ELowEntryHmacAlgorithm Algorithm);
+
+	/**
+	* Returns true if both byte arrays are the same, takes the same amount of time no matter where they differ.
+	*/
+	static bool ConstantTimeEquals(const uint8* A, const int64 ALength, const uint8* B, const int64 BLength);
+};
@@ -12,7 +12,11 @@ private:
 	const static uint8 pearson[256];
 
 
+private:
+	static void advance(uint8* lanes, const int32 laneCount, const uint8* bytes, const int32 start, const int32 count);
+
+
 public:
-	static TArray<uint8> Hash(const TArray<uint8>& Bytes, const int32 HashLength) { return Hash(Bytes, 0, 0xf7777777, HashLength); }
+	static TArray<uint8> Hash(const TArray<uint8>& Bytes, const int32 HashLength) { return Hash(Bytes, 0, 0x7FFFFFFF, HashLength); }
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, int32 Index, int32 Length, const int32 HashLength);
 };
@@ -11,6 +11,7 @@ class ULowEntryHashingSha256Library
 private:
 	const static int32 k[64];
 	constexpr static int32 BLOCK_SIZE = 64;
+	constexpr static int32 FILE_CHUNK_SIZE = 64 * 1024;
 
 
 private:
@@ -31,15 +32,45 @@ private:
 
 private:
 	void initialize();
-	void update(const TArray<uint8>& b, const int64 offset, const int64 len);
+	void update(const uint8* b, const int64 len);
 	TArray<uint8> digest();
 	TArray<uint8> padBuffer();
 	TArray<uint8> getResult();
-	void sha(const TArray<uint8>& in, int64 offset);
+	void shaBlocks(const uint8* in, const int64 blocks);
+	void sha(const uint8* in);
 	FORCEINLINE static int32 s(const int32 a, const int32 b);
 
 
+public:
+	/**
+	* Creates a hasher that is ready to be given data with Update().
+	*/
+	ULowEntryHashingSha256Library();
+
+	/**
+	* Adds the given bytes to the data that is being hashed, can be called any amount of times.
+	*/
+	void Update(const uint8* Bytes, const int64 Length);
+
+	/**
+	* Returns the hash of all the data given so far (32 bytes), the hasher is reset afterwards so it can be used again.
+	*/
+	TArray<uint8> Final();
+
+	/**
+	* Resets the hasher, throwing away all the data given so far.
+	*/
+	void Reset();
+
+
 public:
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes);
 	static TArray<uint8> Hash(const TArray<uint8>& Bytes, int32 Index, int32 Length);
+
+	/**
+	* Hashes the given file, reads it in chunks so the file never has to be fully loaded into memory.
+	*
+	* Returns false if the file couldn't be opened or read.
+	*/
+	static bool HashFile(const FString& FilePath, TArray<uint8>& OutHash);
 };
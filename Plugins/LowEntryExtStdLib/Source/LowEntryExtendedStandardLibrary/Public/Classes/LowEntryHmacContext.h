@@ -0,0 +1,81 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryHmacAlgorithm.h"
+#include "LowEntryHashingHmacLibrary.h"
+
+#include "LowEntryHmacContext.generated.h"
+
+
+class ULowEntryByteRope;
+
+
+/**
+* Generates HMAC hashes with a key that is only processed once, which makes it much faster than the Generate Hash (HMAC) blueprint when many messages are signed with the same key.
+*
+* The message can also be given in multiple parts before the hash is generated.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryHmacContext : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryHmacContext* Create(const TArray<uint8>& Key, const ELowEntryHmacAlgorithm Algorithm);
+
+
+public:
+	ULowEntryHashingHmacLibrary Hasher;
+
+
+	/**
+	* Adds the given bytes to the message that is being hashed.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Update", AdvancedDisplay = "1"))
+	void Update(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Adds the bytes of the given Byte Rope to the message that is being hashed, fragment by fragment, without merging them first.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Update (Byte Rope)"))
+	void UpdateRope(ULowEntryByteRope* Rope);
+
+	/**
+	* Returns the HMAC hash of all the data given so far.
+	*
+	* Resets the context afterwards, so it can be used again for a new message, the key is kept.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Final"))
+	TArray<uint8> Final();
+
+	/**
+	* Throws away all the data given so far, the key is kept.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Reset"))
+	void Reset();
+
+	/**
+	* Returns the HMAC hash of the given bytes.
+	*
+	* Throws away any data that was given with Update before.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Sign", AdvancedDisplay = "1"))
+	TArray<uint8> Sign(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Returns true if the given hash is the HMAC hash of the given bytes.
+	*
+	* The hashes are compared in constant time, so the time it takes doesn't reveal how much of the given hash was correct. Throws away any data that was given with Update before.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|HMAC Context", Meta = (DisplayName = "Verify", AdvancedDisplay = "2"))
+	bool Verify(const TArray<uint8>& ByteArray, const TArray<uint8>& Hash, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+};
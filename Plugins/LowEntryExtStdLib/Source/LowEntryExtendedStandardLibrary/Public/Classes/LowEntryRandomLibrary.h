@@ -0,0 +1,39 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+* Generates random bytes in bulk.
+*
+* Secure bytes come from a ChaCha20 stream per thread, which is seeded by the operating system (BCryptGenRandom, getrandom, arc4random_buf or /dev/urandom) and rekeys itself whenever its buffer of 1024 bytes is refilled and after every request that doesn't fit in that buffer. Bytes are wiped from the buffer as soon as they are handed out, so earlier output can't be recovered from the state. Fast bytes come from a xoshiro256** generator per thread (seeded by the secure stream), which is not suitable for salts, keys or nonces.
+*
+* Both can safely be called from multiple threads at the same time.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryRandomLibrary
+{
+public:
+	/**
+	* Fills the given bytes with cryptographically secure random bytes.
+	*/
+	static void SecureRandomBytes(uint8* Bytes, const int64 Length);
+
+	/**
+	* Fills the given bytes with random bytes that are fast to generate but not cryptographically secure.
+	*/
+	static void FastRandomBytes(uint8* Bytes, const int64 Length);
+
+
+	/**
+	* Returns the given amount of cryptographically secure random bytes.
+	*/
+	static TArray<uint8> SecureRandomBytes(const int32 Length);
+
+	/**
+	* Returns the given amount of random bytes that are fast to generate but not cryptographically secure.
+	*/
+	static TArray<uint8> FastRandomBytes(const int32 Length);
+};
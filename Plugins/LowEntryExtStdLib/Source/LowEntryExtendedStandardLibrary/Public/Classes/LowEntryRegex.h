@@ -0,0 +1,70 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Internationalization/Regex.h"
+
+#include "FLowEntryRegexMatch.h"
+
+#include "LowEntryRegex.generated.h"
+
+
+/**
+* A compiled regex pattern, the pattern is only compiled once, when this object is created, instead of every time it's used.
+*
+* Keep this around for patterns that are used often (like the patterns of a chat filter).
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryRegex : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryRegex* Create(const FString& Pattern);
+
+
+public:
+	FString Pattern;
+	TOptional<FRegexPattern> CompiledPattern;
+
+
+	/**
+	* Returns the pattern this regex was created with.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Get Pattern"))
+	FString GetPattern();
+
+	/**
+	* Returns true if a regex match was found in the given String.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Match"))
+	bool Match(const FString& String);
+
+	/**
+	* Returns the number of times the regex matched in the given String.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Count"))
+	int32 Count(const FString& String);
+
+	/**
+	* Returns the begin index, end index and matched string of each regex match (including each capture group of the regex) found in the given String.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Get Matches"))
+	TArray<FLowEntryRegexMatch> GetMatches(const FString& String);
+
+	/**
+	* Returns the begin index and end index of each regex match (including each capture group of the regex) found in the given String, the matched strings are left empty.
+	*
+	* This is faster than Get Matches, since no strings are created. Use "Regex Match To String" or "Regex Capture Group To String" to get the strings of the matches you need.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Get Match Offsets"))
+	TArray<FLowEntryRegexMatch> GetMatchOffsets(const FString& String);
+
+	/**
+	* Replaces every regex match with the given replacement String.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Utilities|String|Regex", Meta = (DisplayName = "Replace"))
+	FString Replace(const FString& String, const FString& Replacement);
+};
@@ -0,0 +1,40 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Internationalization/Regex.h"
+
+#include "FLowEntryRegexMatch.h"
+
+
+class ULowEntryRegexLibrary
+{
+public:
+	/** The amount of compiled patterns that are kept, the least recently used pattern is thrown away first. */
+	constexpr static int32 CACHE_SIZE = 128;
+
+
+public:
+	/**
+	* Returns the compiled version of the given pattern, only compiles the pattern if it isn't in the cache yet.
+	*
+	* Can be called from any thread.
+	*/
+	static FRegexPattern GetCachedPattern(const FString& Pattern);
+
+	static void ClearCache();
+
+
+	static bool Match(const FRegexPattern& Pattern, const FString& String);
+	static int32 Count(const FRegexPattern& Pattern, const FString& String);
+
+	/**
+	* Returns every match (and the capture groups of every match). If IncludeStrings is false, only the begin and end indices are filled in, the strings can then be retrieved later with Mid.
+	*/
+	static TArray<FLowEntryRegexMatch> GetMatches(const FRegexPattern& Pattern, const FString& String, const bool IncludeStrings);
+
+	static FString Replace(const FRegexPattern& Pattern, const FString& String, const FString& Replacement);
+};
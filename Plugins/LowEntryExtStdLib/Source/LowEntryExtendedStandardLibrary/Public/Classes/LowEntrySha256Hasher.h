@@ -0,0 +1,58 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LowEntryHashingSha256Library.h"
+
+#include "LowEntrySha256Hasher.generated.h"
+
+
+class ULowEntryByteRope;
+
+
+/**
+* Generates a SHA-256 hash of data that is given in parts, so the data never has to be in memory all at once.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntrySha256Hasher : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntrySha256Hasher* Create();
+
+
+public:
+	ULowEntryHashingSha256Library Hasher;
+
+
+	/**
+	* Adds the given bytes to the data that is being hashed.
+	*
+	* PS: the Index and Length parameters refer to the Byte Array (see the "Get Bytes Sub Array" blueprint for more information).
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-256 Hasher", Meta = (DisplayName = "Update", AdvancedDisplay = "1"))
+	void Update(const TArray<uint8>& ByteArray, int32 Index = 0, int32 Length = 0x7FFFFFFF);
+
+	/**
+	* Adds the bytes of the given Byte Rope to the data that is being hashed, fragment by fragment, without merging them first.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-256 Hasher", Meta = (DisplayName = "Update (Byte Rope)"))
+	void UpdateRope(ULowEntryByteRope* Rope);
+
+	/**
+	* Returns the SHA-256 hash of all the data given so far, always returns 32 bytes.
+	*
+	* Resets the hasher afterwards, so it can be used again for new data.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-256 Hasher", Meta = (DisplayName = "Final"))
+	TArray<uint8> Final();
+
+	/**
+	* Throws away all the data given so far.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Hashes|Sha-256 Hasher", Meta = (DisplayName = "Reset"))
+	void Reset();
+};
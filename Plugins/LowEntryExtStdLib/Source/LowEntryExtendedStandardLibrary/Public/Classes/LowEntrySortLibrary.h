@@ -0,0 +1,194 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+
+
+/**
+* Native sorting, for sorting arrays from C++ without having to go through a Blueprint comparator for every comparison.
+*
+* All sorts are stable (elements that are equal keep their order), large arrays are sorted on all worker threads.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntrySortLibrary
+{
+public:
+	/** Below this amount of elements everything is sorted on the calling thread. */
+	constexpr static int32 PARALLEL_SORT_MIN_COUNT = 4096;
+
+
+public:
+	/**
+	* Sorts the given array with the given comparator, which should return true if A should come before B.
+	*
+	* If Reversed is true, the array is sorted the other way around (equal elements still keep their order).
+	*/
+	template<typename T, typename LessType>
+	static void Sort(TArray<T>& Array, const LessType& Less, const bool Reversed = false)
+	{
+		if (!Reversed)
+		{
+			StableSort(Array.GetData(), Array.Num(), Less);
+		}
+		else
+		{
+			StableSort(Array.GetData(), Array.Num(), [&Less](const T& A, const T& B)
+			{
+				return Less(B, A);
+			});
+		}
+	}
+
+	/**
+	* Sorts the given array by the keys that the given function returns, the function is called only once for every element.
+	*
+	* The keys are sorted from low to high, or from high to low if Reversed is true.
+	*/
+	template<typename T, typename KeyFunctionType>
+	static void SortByKey(TArray<T>& Array, const KeyFunctionType& GetKey, const bool Reversed = false)
+	{
+		typedef std::decay_t<decltype(GetKey(DeclVal<const T&>()))> KeyType;
+		TArray<KeyType> Keys;
+		Keys.Reserve(Array.Num());
+		for (const T& Element : Array)
+		{
+			Keys.Add(GetKey(Element));
+		}
+		SortByKeys(Array, Keys, Reversed);
+	}
+
+	/**
+	* Sorts the given array by the given keys, Keys[i] is the key of Array[i].
+	*
+	* The keys are sorted from low to high, or from high to low if Reversed is true.
+	*/
+	template<typename T, typename KeyType>
+	static void SortByKeys(TArray<T>& Array, const TArray<KeyType>& Keys, const bool Reversed = false)
+	{
+		const int32 Num = FMath::Min(Array.Num(), Keys.Num());
+		if (Num < 2)
+		{
+			return;
+		}
+
+		// only the keys and indices are moved around while sorting, the elements themselves are moved once at the end
+		TArray<TPair<KeyType, int32>> Order;
+		Order.Reserve(Num);
+		for (int32 i = 0; i < Num; i++)
+		{
+			Order.Emplace(Keys[i], i);
+		}
+		Sort(Order, [](const TPair<KeyType, int32>& A, const TPair<KeyType, int32>& B)
+		{
+			return A.Key < B.Key;
+		}, Reversed);
+
+		TArray<T> Sorted;
+		Sorted.Reserve(Array.Num());
+		for (const TPair<KeyType, int32>& Entry : Order)
+		{
+			Sorted.Add(MoveTemp(Array[Entry.Value]));
+		}
+		for (int32 i = Num; i < Array.Num(); i++)
+		{
+			Sorted.Add(MoveTemp(Array[i]));
+		}
+		Array = MoveTemp(Sorted);
+	}
+
+	/**
+	* A stable merge sort, the array is split into one part per worker thread, each part is sorted on its own thread, after which the parts are merged (also in parallel, until only two parts are left).
+	*
+	* T has to be default constructible and movable.
+	*/
+	template<typename T, typename LessType>
+	static void StableSort(T* Data, const int32 Num, const LessType& Less)
+	{
+		if (Num < 2)
+		{
+			return;
+		}
+
+		const int32 Parts = GetPartCount(Num);
+		if (Parts <= 1)
+		{
+			Algo::StableSort(TArrayView<T>(Data, Num), Less);
+			return;
+		}
+
+		TArray<int32> Bounds;
+		Bounds.SetNumUninitialized(Parts + 1);
+		for (int32 i = 0; i <= Parts; i++)
+		{
+			Bounds[i] = static_cast<int32>((static_cast<int64>(Num) * i) / Parts);
+		}
+
+		ParallelFor(Parts, [Data, &Bounds, &Less](const int32 i)
+		{
+			Algo::StableSort(TArrayView<T>(Data + Bounds[i], Bounds[i + 1] - Bounds[i]), Less);
+		});
+
+		TArray<T> Buffer;
+		Buffer.SetNum(Num);
+		T* Src = Data;
+		T* Dest = Buffer.GetData();
+		for (int32 Width = 1; Width < Parts; Width *= 2)
+		{
+			const int32 Merges = ((Parts - 1) / (Width * 2)) + 1;
+			ParallelFor(Merges, [Src, Dest, &Bounds, &Less, Width, Parts](const int32 i)
+			{
+				const int32 Left = Bounds[FMath::Min(i * Width * 2, Parts)];
+				const int32 Middle = Bounds[FMath::Min((i * Width * 2) + Width, Parts)];
+				const int32 Right = Bounds[FMath::Min((i * Width * 2) + (Width * 2), Parts)];
+				Merge(Src, Left, Middle, Right, Dest, Less);
+			}, (Merges <= 1));
+			Swap(Src, Dest);
+		}
+		if (Src != Data)
+		{
+			for (int32 i = 0; i < Num; i++)
+			{
+				Data[i] = MoveTemp(Src[i]);
+			}
+		}
+	}
+
+
+protected:
+	/**
+	* Returns the amount of parts the given amount of elements should be split into for sorting, returns 1 if the elements should be sorted on the calling thread.
+	*/
+	static int32 GetPartCount(const int32 Num);
+
+	template<typename T, typename LessType>
+	static void Merge(T* Src, const int32 Left, const int32 Middle, const int32 Right, T* Dest, const LessType& Less)
+	{
+		int32 a = Left;
+		int32 b = Middle;
+		int32 o = Left;
+		while ((a < Middle) && (b < Right))
+		{
+			// on a tie the element of the left part goes first, which keeps the sort stable
+			if (Less(Src[b], Src[a]))
+			{
+				Dest[o++] = MoveTemp(Src[b++]);
+			}
+			else
+			{
+				Dest[o++] = MoveTemp(Src[a++]);
+			}
+		}
+		while (a < Middle)
+		{
+			Dest[o++] = MoveTemp(Src[a++]);
+		}
+		while (b < Right)
+		{
+			Dest[o++] = MoveTemp(Src[b++]);
+		}
+	}
+};
@@ -0,0 +1,58 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "Engine/Texture2D.h"
+
+#include "LowEntryTexturePool.generated.h"
+
+
+/**
+* Keeps textures that aren't used anymore, so they can be reused for new images of the same size instead of creating a new texture every time.
+*
+* Reusing a texture means its pixels can be updated in place, instead of the texture having to be created on the GPU again.
+*/
+UCLASS(BlueprintType)
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API ULowEntryTexturePool : public UObject
+{
+	GENERATED_UCLASS_BODY()
+public:
+	static ULowEntryTexturePool* Create(const int32 MaxTexturesPerSize);
+
+
+public:
+	UPROPERTY()
+	TArray<UTexture2D*> Textures;
+
+	int32 MaxTexturesPerSize = 4;
+
+
+	/**
+	* Returns a texture of the given size from the pool, removing it from the pool. Returns nullptr if the pool has no texture of this size.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|Texture Pool", Meta = (DisplayName = "Take Texture"))
+	UTexture2D* Take(const int32 Width, const int32 Height);
+
+	/**
+	* Gives a texture back to the pool, so it can be reused later on. The texture shouldn't be used anymore after this.
+	*
+	* If the pool already has the maximum amount of textures of this size, the texture isn't kept.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|Texture Pool", Meta = (DisplayName = "Give Texture Back"))
+	void GiveBack(UTexture2D* Texture2D);
+
+	/**
+	* Returns the amount of textures that are currently in the pool.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Low Entry|Extended Standard Library|Image|Texture Pool", Meta = (DisplayName = "Get Count"))
+	int32 GetCount();
+
+	/**
+	* Removes all textures from the pool.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Low Entry|Extended Standard Library|Image|Texture Pool", Meta = (DisplayName = "Clear"))
+	void Clear();
+};
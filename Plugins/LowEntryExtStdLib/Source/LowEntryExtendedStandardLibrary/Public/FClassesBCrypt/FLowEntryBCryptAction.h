@@ -0,0 +1,102 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+
+#include "LowEntryHashingBCryptLibrary.h"
+#include "LowEntryByteArray.h"
+
+
+/**
+* Generates BCrypt hashes on the thread pool, and triggers the latent node once they are all done.
+*
+* Hashes that haven't been started yet are skipped when the latent action is aborted or its owner is destroyed.
+*/
+class FLowEntryBCryptAction : public FPendingLatentAction
+{
+public:
+	struct FState
+	{
+		FThreadSafeBool Cancelled = false;
+		FThreadSafeBool Finished = false;
+		TArray<TArray<uint8>> Hashes;
+	};
+
+
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	TArray<ULowEntryByteArray*>* ResultArray;
+	TArray<uint8>* ResultBytes;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+
+	FLowEntryBCryptAction(const TArray<TArray<uint8>>& Bytes, const TArray<TArray<uint8>>& Salts, const int32 Strength, TArray<ULowEntryByteArray*>* ResultArray0, TArray<uint8>* ResultBytes0, const FLatentActionInfo& LatentInfo)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, ResultArray(ResultArray0)
+		, ResultBytes(ResultBytes0)
+		, State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{
+		TSharedRef<FState, ESPMode::ThreadSafe> TaskState = State;
+		Async(EAsyncExecution::ThreadPool, [TaskState, Bytes, Salts, Strength]()
+		{
+			TaskState->Hashes = ULowEntryHashingBCryptLibrary::HashArray(Bytes, Salts, Strength, &TaskState->Cancelled);
+			TaskState->Finished = true;
+		});
+	}
+
+	virtual ~FLowEntryBCryptAction()
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!State->Finished)
+		{
+			return;
+		}
+		if (ResultArray != nullptr)
+		{
+			// UObjects can only be created on the game thread, so the results are only wrapped here
+			ResultArray->SetNum(State->Hashes.Num());
+			for (int32 i = 0; i < State->Hashes.Num(); i++)
+			{
+				(*ResultArray)[i] = ULowEntryByteArray::CreateFromByteArray(State->Hashes[i]);
+			}
+		}
+		if (ResultBytes != nullptr)
+		{
+			*ResultBytes = (State->Hashes.Num() > 0) ? MoveTemp(State->Hashes[0]) : TArray<uint8>();
+		}
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	virtual void NotifyObjectDestroyed() override
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void NotifyActionAborted() override
+	{
+		State->Cancelled = true;
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return State->Finished ? TEXT("BCrypt (done)") : TEXT("BCrypt (hashing)");
+	}
+#endif
+};
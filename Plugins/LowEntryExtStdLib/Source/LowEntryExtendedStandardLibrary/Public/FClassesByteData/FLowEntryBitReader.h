@@ -0,0 +1,112 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "FLowEntryVarint.h"
+
+
+/**
+* Reads Bit Data, without creating any UObjects.
+*
+* This is what ULowEntryBitDataReader uses internally, it can be used directly from C++ (on the stack, as a member, etc) to deserialize data without any garbage collection overhead.
+*
+* Doesn't copy or own the bytes, the memory it reads from has to stay alive for as long as the reader is being used.
+*
+* Whenever enough bits are available, values are read with a single unaligned load of up to 8 bytes instead of bit by bit.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryBitReader
+{
+private:
+	const static uint8 mask[9];
+
+
+public:
+	FLowEntryBitReader() = default;
+	explicit FLowEntryBitReader(const TArrayView<const uint8>& Bytes0);
+
+
+public:
+	TArrayView<const uint8> Bytes;
+	int32 Position = 0;
+	uint8 CurrentByte = 0;
+	int32 CurrentBytePosition = 0;
+
+
+	int32 GetAndIncreasePosition(const int32 Increasement);
+	int32 MaxElementsRemaining(const int32 MinimumSizePerElement) const;
+
+	int32 GetPosition() const;
+	void SetPosition(const int32 Position_);
+	void Reset();
+	void Empty();
+	int32 Remaining() const;
+
+
+	bool GetRawBit();
+	uint8 GetRawByte();
+	uint8 GetPartialRawByte(int32 Bits);
+
+	/**
+	* Reads up to the given amount of bytes into Dest, returns the amount of bytes that were actually available.
+	*/
+	int32 GetRawBytes(uint8* Dest, const int32 Count);
+
+	int32 GetUinteger();
+
+
+	bool GetBit();
+	uint8 GetByteLeastSignificantBits(const int32 BitCount);
+	uint8 GetByteMostSignificantBits(const int32 BitCount);
+	int32 GetIntegerLeastSignificantBits(const int32 BitCount);
+	int32 GetIntegerMostSignificantBits(int32 BitCount);
+	uint8 GetByte();
+	int32 GetInteger();
+	int32 GetPositiveInteger1();
+	int32 GetPositiveInteger2();
+	int32 GetPositiveInteger3();
+	int64 GetLong();
+	float GetFloat();
+	double GetDouble();
+	bool GetBoolean();
+	FString GetStringUtf8();
+	int32 GetVarInteger();
+	int64 GetVarLong();
+	int32 GetZigZagInteger();
+	int64 GetZigZagLong();
+
+	TArray<bool> GetBitArray();
+	TArray<uint8> GetByteArrayLeastSignificantBits(const int32 BitCount);
+	TArray<uint8> GetByteArrayMostSignificantBits(const int32 BitCount);
+	TArray<int32> GetIntegerArrayLeastSignificantBits(const int32 BitCount);
+	TArray<int32> GetIntegerArrayMostSignificantBits(const int32 BitCount);
+	TArray<uint8> GetByteArray();
+	TArray<int32> GetIntegerArray();
+	TArray<int32> GetPositiveInteger1Array();
+	TArray<int32> GetPositiveInteger2Array();
+	TArray<int32> GetPositiveInteger3Array();
+	TArray<int64> GetLongArray();
+	TArray<float> GetFloatArray();
+	TArray<double> GetDoubleArray();
+	TArray<bool> GetBooleanArray();
+	TArray<FString> GetStringUtf8Array();
+	TArray<int32> GetIntegerArrayDelta();
+	TArray<int64> GetLongArrayDelta();
+
+
+	static int32 SafeMultiply(const int32 A, const int32 B);
+
+
+protected:
+	int64 GetBitIndex() const;
+	bool HasBits(const int32 Count) const;
+
+	/**
+	* Reads Count bits (1 to 32), least significant bit first. The caller has to make sure that HasBits(Count) is true.
+	*/
+	uint32 ReadBits(const int32 Count);
+	void ReadBools(bool* Dest, const int32 Count);
+	uint64 ReadVarint(const int32 MaxSize);
+};
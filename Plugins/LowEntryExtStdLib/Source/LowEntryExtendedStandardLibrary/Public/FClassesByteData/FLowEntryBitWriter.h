@@ -0,0 +1,90 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "FLowEntryVarint.h"
+
+
+/**
+* Writes Bit Data, without creating any UObjects.
+*
+* This is what ULowEntryBitDataWriter uses internally, it can be used directly from C++ (on the stack, as a member, etc) to serialize data without any garbage collection overhead.
+*
+* Calling Reset() keeps the allocated memory, so a single writer can be reused for many messages without reallocating.
+*
+* Bits are gathered in a 64 bit accumulator and are only moved into Bytes once it is full, GetBytes() appends whatever is still pending.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryBitWriter
+{
+public:
+	TArray<uint8> Bytes;
+	uint64 Accumulator = 0;
+	int32 AccumulatorBits = 0;
+
+
+	TArray<uint8> GetBytes() const;
+
+	void Reset();
+
+
+	void AddRawBit(const bool Value);
+	void AddRawByte(const uint8 Value);
+	void AddPartialRawByte(uint8 Value, int32 Bits);
+	void AddRawBytes(const TArrayView<const uint8>& Value);
+
+	void AddUinteger(const int32 Value);
+
+
+	void AddBit(const bool Value);
+	void AddByteLeastSignificantBits(const uint8 Value, const int32 BitCount);
+	void AddByteMostSignificantBits(const uint8 Value, const int32 BitCount);
+	void AddIntegerLeastSignificantBits(const int32 Value, const int32 BitCount);
+	void AddIntegerMostSignificantBits(const int32 Value, int32 BitCount);
+	void AddByte(const uint8 Value);
+	void AddInteger(const int32 Value);
+	void AddPositiveInteger1(const int32 Value);
+	void AddPositiveInteger2(const int32 Value);
+	void AddPositiveInteger3(const int32 Value);
+	void AddLong(const int64 Value);
+	void AddFloat(const float Value);
+	void AddDouble(const double Value);
+	void AddBoolean(const bool Value);
+	void AddStringUtf8(const FString& Value);
+	void AddVarInteger(const int32 Value);
+	void AddVarLong(const int64 Value);
+	void AddZigZagInteger(const int32 Value);
+	void AddZigZagLong(const int64 Value);
+
+	void AddBitArray(const TArrayView<const bool>& Value);
+	void AddByteArrayLeastSignificantBits(const TArrayView<const uint8>& Value, const int32 BitCount);
+	void AddByteArrayMostSignificantBits(const TArrayView<const uint8>& Value, const int32 BitCount);
+	void AddIntegerArrayLeastSignificantBits(const TArrayView<const int32>& Value, const int32 BitCount);
+	void AddIntegerArrayMostSignificantBits(const TArrayView<const int32>& Value, const int32 BitCount);
+	void AddByteArray(const TArrayView<const uint8>& Value);
+	void AddIntegerArray(const TArrayView<const int32>& Value);
+	void AddPositiveInteger1Array(const TArrayView<const int32>& Value);
+	void AddPositiveInteger2Array(const TArrayView<const int32>& Value);
+	void AddPositiveInteger3Array(const TArrayView<const int32>& Value);
+	void AddLongArray(const TArrayView<const int64>& Value);
+	void AddFloatArray(const TArrayView<const float>& Value);
+	void AddDoubleArray(const TArrayView<const double>& Value);
+	void AddBooleanArray(const TArrayView<const bool>& Value);
+	void AddStringUtf8Array(const TArrayView<const FString>& Value);
+	void AddIntegerArrayDelta(const TArrayView<const int32>& Value);
+	void AddLongArrayDelta(const TArrayView<const int64>& Value);
+
+
+protected:
+	/**
+	* Writes the lowest Count bits of Value (Count can be 0 to 32), least significant bit first.
+	*/
+	void AddBits(const uint32 Value, const int32 Count);
+	void AddBools(const TArrayView<const bool>& Value);
+	void AddVarint(const uint64 Value);
+
+	void FlushAccumulator();
+	void FlushWholeBytes();
+};
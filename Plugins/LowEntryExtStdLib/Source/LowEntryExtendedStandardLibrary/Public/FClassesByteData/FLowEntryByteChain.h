@@ -0,0 +1,87 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+
+/**
+* A sequence of bytes that consists of fragments, without copying the fragments into one array.
+*
+* Fragments are shared (reference counted and immutable), so appending a chain to another chain, or taking a slice of a chain, never copies any bytes. Appending a TArray by rvalue moves it into the chain, only appending a const TArray copies it.
+*
+* The bytes are only copied into one array once, when Flatten() or CopyTo() is called. Writers and hashers can also consume the fragments directly.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteChain
+{
+public:
+	typedef TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> FBytesRef;
+
+	struct FFragment
+	{
+		FBytesRef Bytes;
+		int32 Offset;
+		int32 Length;
+
+		FORCEINLINE TArrayView<const uint8> GetView() const
+		{
+			return TArrayView<const uint8>(Bytes->GetData() + Offset, Length);
+		}
+	};
+
+
+public:
+	FLowEntryByteChain() = default;
+	explicit FLowEntryByteChain(TArray<uint8>&& Bytes);
+
+
+protected:
+	TArray<FFragment, TInlineAllocator<4>> Fragments;
+	int64 Length = 0;
+
+
+public:
+	int64 Num() const;
+	bool IsEmpty() const;
+	int32 GetFragmentCount() const;
+	const FFragment& GetFragment(const int32 Index) const;
+
+	void Reset();
+
+
+	void Append(TArray<uint8>&& Bytes);
+	void Append(const TArrayView<const uint8>& Bytes);
+	void Append(const FBytesRef& Bytes, int32 Index = 0, int32 Count = 0x7FFFFFFF);
+	void Append(const FLowEntryByteChain& Chain);
+
+	void Prepend(TArray<uint8>&& Bytes);
+	void Prepend(const TArrayView<const uint8>& Bytes);
+	void Prepend(const FBytesRef& Bytes, int32 Index = 0, int32 Count = 0x7FFFFFFF);
+	void Prepend(const FLowEntryByteChain& Chain);
+
+
+	/**
+	* Returns the bytes of the given range as a new chain, which shares the fragments with this chain.
+	*/
+	FLowEntryByteChain Slice(int64 Index, int64 Count = 0x7FFFFFFFFFFFFFFF) const;
+
+	/**
+	* Copies all the bytes into Dest, which has to be at least Num() bytes large.
+	*/
+	void CopyTo(uint8* Dest) const;
+
+	/**
+	* Returns all the bytes in one array, this is the only time the bytes are copied. Returns an empty array if there are more than 2GB of bytes.
+	*/
+	TArray<uint8> Flatten() const;
+
+	/**
+	* Calls the given function for every fragment, in order.
+	*/
+	void ForEachFragment(const TFunctionRef<void(const TArrayView<const uint8>&)>& Function) const;
+
+
+protected:
+	void AddFragment(const FBytesRef& Bytes, const int32 Offset, const int32 Count, const bool AtStart);
+};
@@ -0,0 +1,150 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Templates/UniquePtr.h"
+
+#include "FLowEntryByteSink.h"
+
+
+/**
+* Compresses Byte Data into frames with FCompression (Oodle, Zlib, Gzip or LZ4), and decompresses it again.
+*
+* Every frame starts with a header of 9 bytes: the codec (1 byte), followed by the uncompressed size and the size of the payload (both 4 bytes, big endian), followed by the payload. Frames are independent of each other, so they can be written one at a time as the data is being produced, and a file containing frames can be appended to.
+*
+* Frames smaller than RawThreshold, and frames that don't get any smaller by compressing them, are stored raw (codec 0), so small messages don't pay for the compression.
+*
+* Since the uncompressed size is allocated before a frame is decompressed, frames can be at most MaxFrameSize uncompressed bytes, and compressed frames can't claim more than MaxCompressionRatio times their payload size. Headers that don't respect that are rejected as corrupt, and larger frames are split up when they are encoded.
+*/
+struct LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteCompression
+{
+	static constexpr int32 HeaderSize = 9;
+	static constexpr int32 DefaultFrameSize = 64 * 1024;
+	static constexpr int32 DefaultRawThreshold = 256;
+	static constexpr int32 MaxFrameSize = 16 * 1024 * 1024;
+	static constexpr int32 MaxCompressionRatio = 1024;
+
+	enum ECodec : uint8
+	{
+		CodecRaw = 0,
+		CodecZlib = 1,
+		CodecGzip = 2,
+		CodecLZ4 = 3,
+		CodecOodle = 4,
+	};
+
+	struct FFrameHeader
+	{
+		uint8 Codec = CodecRaw;
+		int32 RawSize = 0;
+		int32 PayloadSize = 0;
+	};
+
+
+	/**
+	* Returns the codec for the given FCompression format name, or CodecRaw if the format isn't supported.
+	*/
+	static uint8 GetCodec(const FName& Format);
+	static FName GetFormat(const uint8 Codec);
+
+
+	/**
+	* Appends a single frame containing the given bytes to Out, or multiple frames if the bytes are larger than MaxFrameSize or compress better than MaxCompressionRatio.
+	*/
+	static void EncodeFrame(const TArrayView<const uint8>& Bytes, TArray<uint8>& Out, const FName& Format = NAME_Oodle, const int32 RawThreshold = DefaultRawThreshold);
+
+	/**
+	* Reads the header of a frame, returns false if it isn't a valid header. Src has to have HeaderSize bytes.
+	*/
+	static bool ReadHeader(const uint8* Src, FFrameHeader& Header);
+
+	/**
+	* Decompresses the payload of a frame into Dest, which has to have room for Header.RawSize bytes.
+	*/
+	static bool DecodePayload(const FFrameHeader& Header, const uint8* Payload, uint8* Dest);
+
+
+	/**
+	* Compresses the given bytes into frames of (at most) FrameSize uncompressed bytes each (FrameSize is clamped to MaxFrameSize), and appends them to Out.
+	*/
+	static void Compress(const TArrayView<const uint8>& Bytes, TArray<uint8>& Out, const FName& Format = NAME_Oodle, const int32 FrameSize = DefaultFrameSize, const int32 RawThreshold = DefaultRawThreshold);
+
+	/**
+	* Decompresses all frames in the given bytes and appends the result to Out, returns false if the frames are incomplete or corrupt.
+	*/
+	static bool Decompress(const TArrayView<const uint8>& Frames, TArray<uint8>& Out);
+};
+
+
+/**
+* Compresses every chunk it receives into a frame, and passes the frame on to another sink.
+*
+* Put it in front of an FLowEntryByteArchiveSink to have a streaming FLowEntryByteWriter write a compressed file: chunks are compressed on the thread that is writing, while the previous frame is being written to the file on the thread pool.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteCompressionSink : public FLowEntryByteSink
+{
+public:
+	explicit FLowEntryByteCompressionSink(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Inner, const FName& Format = NAME_Oodle, const int32 RawThreshold = FLowEntryByteCompression::DefaultRawThreshold);
+
+
+protected:
+	TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe> Inner;
+	FName Format;
+	int32 RawThreshold = FLowEntryByteCompression::DefaultRawThreshold;
+	TArray<uint8> Frame;
+
+
+public:
+	virtual void Write(TArray<uint8>& Chunk) override;
+	virtual bool Flush() override;
+};
+
+
+/**
+* Reads the decompressed bytes of an FArchive (a file for example) that contains frames, as if the bytes were stored uncompressed.
+*
+* Seeking is supported: the frame headers are indexed when the archive is created, and only the frame that is being read from is decompressed. If the data contains a corrupt header or ends with an incomplete frame, the archive is put in an error state right away, so that damaged data can't be mistaken for a shorter stream.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteDecompressionArchive : public FArchive
+{
+public:
+	explicit FLowEntryByteDecompressionArchive(TUniquePtr<FArchive>&& Inner);
+
+	FLowEntryByteDecompressionArchive(const FLowEntryByteDecompressionArchive&) = delete;
+	FLowEntryByteDecompressionArchive& operator=(const FLowEntryByteDecompressionArchive&) = delete;
+
+
+protected:
+	struct FFrame
+	{
+		int64 RawStart = 0;
+		int64 PayloadOffset = 0;
+		FLowEntryByteCompression::FFrameHeader Header;
+	};
+
+	TUniquePtr<FArchive> Inner;
+	TArray<FFrame> Frames;
+	int64 RawTotalSize = 0;
+	int64 Pos = 0;
+
+	int32 CurrentFrame = INDEX_NONE;
+	TArray<uint8> CurrentBytes;
+	TArray<uint8> Payload;
+
+
+public:
+	virtual void Serialize(void* Data, int64 Length) override;
+	virtual int64 Tell() override;
+	virtual int64 TotalSize() override;
+	virtual void Seek(int64 InPos) override;
+	virtual bool Close() override;
+	virtual FString GetArchiveName() const override;
+
+
+protected:
+	int32 FindFrame(const int64 Position) const;
+	bool LoadFrame(const int32 Index);
+};
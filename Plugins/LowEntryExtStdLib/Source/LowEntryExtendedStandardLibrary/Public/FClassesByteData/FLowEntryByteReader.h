@@ -0,0 +1,85 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "FLowEntryVarint.h"
+
+
+/**
+* Reads Byte Data, without creating any UObjects.
+*
+* This is what ULowEntryByteDataReader uses internally, it can be used directly from C++ (on the stack, as a member, etc) to deserialize data without any garbage collection overhead.
+*
+* Doesn't copy or own the bytes, the memory it reads from has to stay alive for as long as the reader is being used.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteReader
+{
+public:
+	FLowEntryByteReader() = default;
+	explicit FLowEntryByteReader(const TArrayView<const uint8>& Bytes0);
+
+
+public:
+	TArrayView<const uint8> Bytes;
+	int32 Position = 0;
+
+
+	int32 GetAndIncreasePosition(const int32 Increasement);
+	int32 MaxElementsRemaining(const int32 MinimumSizePerElement) const;
+
+	int32 GetPosition() const;
+	void SetPosition(const int32 Position_);
+	void Reset();
+	void Empty();
+	int32 Remaining() const;
+
+
+	/**
+	* Reads up to the given amount of bytes into Dest, returns the amount of bytes that were actually available.
+	*/
+	int32 GetRawBytes(uint8* Dest, const int32 Count);
+
+	int32 GetUinteger();
+
+
+	uint8 GetByte();
+	int32 GetInteger();
+	int32 GetPositiveInteger1();
+	int32 GetPositiveInteger2();
+	int32 GetPositiveInteger3();
+	int64 GetLong();
+	float GetFloat();
+	double GetDouble();
+	bool GetBoolean();
+	FString GetStringUtf8();
+	int32 GetVarInteger();
+	int64 GetVarLong();
+	int32 GetZigZagInteger();
+	int64 GetZigZagLong();
+
+	TArray<uint8> GetByteArray();
+	TArray<int32> GetIntegerArray();
+	TArray<int32> GetPositiveInteger1Array();
+	TArray<int32> GetPositiveInteger2Array();
+	TArray<int32> GetPositiveInteger3Array();
+	TArray<int64> GetLongArray();
+	TArray<float> GetFloatArray();
+	TArray<double> GetDoubleArray();
+	TArray<bool> GetBooleanArray();
+	TArray<FString> GetStringUtf8Array();
+	TArray<int32> GetIntegerArrayDelta();
+	TArray<int64> GetLongArrayDelta();
+
+
+	static int32 SafeMultiply(const int32 A, const int32 B);
+
+
+protected:
+	int32 ReadInteger(int32 Pos) const;
+	int64 ReadLong(int32 Pos) const;
+	TArray<uint8> ReadBytes(int32 Pos, const int32 Length) const;
+	FORCEINLINE uint64 ReadVarint(const int32 MaxSize);
+};
@@ -0,0 +1,90 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+
+
+/**
+* Receives the bytes of a streaming FLowEntryByteWriter, one chunk at a time.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteSink
+{
+public:
+	virtual ~FLowEntryByteSink() = default;
+
+	/**
+	* Takes the bytes of Chunk. Afterwards Chunk is empty, it might have been swapped with an older chunk so that its memory can be reused by the writer.
+	*/
+	virtual void Write(TArray<uint8>& Chunk) = 0;
+
+	/**
+	* Waits until all chunks have been written, returns false if writing any of them failed.
+	*/
+	virtual bool Flush() = 0;
+};
+
+
+/**
+* Writes chunks to an FArchive (a file for example).
+*
+* Chunks are written on the thread pool, so the writer can encode the next chunk while the previous one is being written. The archive must not be used by anything else for as long as this sink exists.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteArchiveSink : public FLowEntryByteSink
+{
+public:
+	explicit FLowEntryByteArchiveSink(FArchive& Archive);
+	explicit FLowEntryByteArchiveSink(TUniquePtr<FArchive>&& Archive);
+	virtual ~FLowEntryByteArchiveSink() override;
+
+	FLowEntryByteArchiveSink(const FLowEntryByteArchiveSink&) = delete;
+	FLowEntryByteArchiveSink& operator=(const FLowEntryByteArchiveSink&) = delete;
+
+	/**
+	* Opens the given file for writing, returns null if the file couldn't be opened.
+	*/
+	static TSharedPtr<FLowEntryByteArchiveSink, ESPMode::ThreadSafe> OpenFile(const FString& FilePath, const bool Append = false);
+
+
+protected:
+	FArchive* Archive = nullptr;
+	TUniquePtr<FArchive> OwnedArchive;
+	TArray<uint8> Pending;
+	TFuture<bool> PendingWrite;
+	bool Failed = false;
+
+
+public:
+	virtual void Write(TArray<uint8>& Chunk) override;
+	virtual bool Flush() override;
+
+
+protected:
+	void WaitForPendingWrite();
+};
+
+
+/**
+* Passes chunks to a function, to send them over a socket for example.
+*
+* The function is called on the thread that is writing, it should return false if the chunk couldn't be handled.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteCallbackSink : public FLowEntryByteSink
+{
+public:
+	explicit FLowEntryByteCallbackSink(TFunction<bool(const TArrayView<const uint8>&)>&& Callback);
+
+
+protected:
+	TFunction<bool(const TArrayView<const uint8>&)> Callback;
+	bool Failed = false;
+
+
+public:
+	virtual void Write(TArray<uint8>& Chunk) override;
+	virtual bool Flush() override;
+};
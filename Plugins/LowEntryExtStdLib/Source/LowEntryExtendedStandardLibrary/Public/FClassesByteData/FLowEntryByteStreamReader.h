@@ -0,0 +1,155 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Templates/UniquePtr.h"
+
+#include "FLowEntryByteReader.h"
+
+
+/**
+* Reads Byte Data from an FArchive (a file for example), without loading all of the data into memory.
+*
+* Only a window of the data is resident at a time: bytes are paged in in chunks of ChunkSize as they are needed, and while the current chunk is being decoded the next chunk is already being read on the thread pool. Byte arrays and strings that are larger than a chunk are read directly into their destination, so memory use stays at about two chunks regardless of the size of the data.
+*
+* Decodes exactly like FLowEntryByteReader does, so data written with ULowEntryByteDataWriter can be read back with either of them. Positions are 64-bit and relative to the position the archive was at when this reader was created.
+*
+* The archive is used from the thread pool while prefetching, so it must not be used by anything else for as long as this reader exists.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteStreamReader
+{
+public:
+	static constexpr int32 DefaultChunkSize = 1024 * 1024;
+
+	FLowEntryByteStreamReader() = default;
+	explicit FLowEntryByteStreamReader(FArchive& Archive, const int32 ChunkSize = DefaultChunkSize);
+	explicit FLowEntryByteStreamReader(TUniquePtr<FArchive>&& Archive, const int32 ChunkSize = DefaultChunkSize);
+	~FLowEntryByteStreamReader();
+
+	FLowEntryByteStreamReader(const FLowEntryByteStreamReader&) = delete;
+	FLowEntryByteStreamReader& operator=(const FLowEntryByteStreamReader&) = delete;
+
+	/**
+	* Opens the given file for reading, returns null if the file couldn't be opened.
+	*/
+	static TUniquePtr<FLowEntryByteStreamReader> OpenFile(const FString& FilePath, const int32 ChunkSize = DefaultChunkSize);
+
+	/**
+	* Opens the given file for reading, decompressing the frames that FLowEntryByteCompression wrote to it. Returns null if the file couldn't be opened, or if it contains a corrupt or incomplete frame.
+	*/
+	static TUniquePtr<FLowEntryByteStreamReader> OpenCompressedFile(const FString& FilePath, const int32 ChunkSize = DefaultChunkSize);
+
+
+protected:
+	FArchive* Archive = nullptr;
+	TUniquePtr<FArchive> OwnedArchive;
+	int64 Origin = 0;
+	int64 TotalSize = 0;
+	int32 ChunkSize = DefaultChunkSize;
+
+	int64 Position = 0;
+
+	TArray<uint8> Window;
+	int64 WindowStart = 0;
+
+	TArray<uint8> PrefetchBuffer;
+	int64 PrefetchStart = 0;
+	TFuture<bool> Prefetch;
+
+
+public:
+	int64 GetPosition() const;
+	void SetPosition(const int64 Position_);
+	void Reset();
+	void Empty();
+	int64 Num() const;
+	int64 Remaining() const;
+	int32 MaxElementsRemaining(const int32 MinimumSizePerElement) const;
+
+	/**
+	* Stops reading and closes the archive if this reader owns it, after this the reader behaves as if it has no data left.
+	*/
+	void Close();
+
+
+	/**
+	* Reads up to the given amount of bytes into Dest, returns the amount of bytes that were actually available.
+	*/
+	int32 GetRawBytes(uint8* Dest, const int32 Count);
+
+	int32 GetUinteger();
+
+
+	uint8 GetByte();
+	int32 GetInteger();
+	int32 GetPositiveInteger1();
+	int32 GetPositiveInteger2();
+	int32 GetPositiveInteger3();
+	int64 GetLong();
+	float GetFloat();
+	double GetDouble();
+	bool GetBoolean();
+	FString GetStringUtf8();
+	int32 GetVarInteger();
+	int64 GetVarLong();
+	int32 GetZigZagInteger();
+	int64 GetZigZagLong();
+
+	TArray<uint8> GetByteArray();
+	TArray<int32> GetIntegerArray();
+	TArray<int32> GetPositiveInteger1Array();
+	TArray<int32> GetPositiveInteger2Array();
+	TArray<int32> GetPositiveInteger3Array();
+	TArray<int64> GetLongArray();
+	TArray<float> GetFloatArray();
+	TArray<double> GetDoubleArray();
+	TArray<bool> GetBooleanArray();
+	TArray<FString> GetStringUtf8Array();
+	TArray<int32> GetIntegerArrayDelta();
+	TArray<int64> GetLongArrayDelta();
+
+
+protected:
+	/**
+	* Makes sure that the next Count bytes (or less, if there aren't that many left) are resident, and returns them. Count can't be larger than ChunkSize.
+	*/
+	TArrayView<const uint8> Ensure(const int32 Count);
+
+	/**
+	* Decodes a value of at most MaxSize bytes with the given FLowEntryByteReader getter, directly from the window.
+	*/
+	template<typename T>
+	FORCEINLINE T Decode(const int32 MaxSize, T (FLowEntryByteReader::*Getter)())
+	{
+		FLowEntryByteReader Reader(Ensure(MaxSize));
+		const T Value = (Reader.*Getter)();
+		Position += Reader.GetPosition();
+		return Value;
+	}
+
+	template<typename T>
+	TArray<T> DecodeArray(const int32 MinimumSizePerElement, const int32 MaxSizePerElement, T (FLowEntryByteReader::*Getter)())
+	{
+		int32 Length = GetUinteger();
+		Length = FMath::Min(Length, MaxElementsRemaining(MinimumSizePerElement));
+		if (Length <= 0)
+		{
+			return TArray<T>();
+		}
+		TArray<T> Array;
+		Array.SetNumUninitialized(Length);
+		for (int32 i = 0; i < Length; i++)
+		{
+			Array[i] = Decode(MaxSizePerElement, Getter);
+		}
+		return Array;
+	}
+
+	void Fill(const int32 Count);
+	void StartPrefetch(const int64 Start);
+	bool WaitForPrefetch();
+	bool ReadFromArchive(const int64 Start, uint8* Dest, const int32 Count);
+};
@@ -0,0 +1,149 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "FLowEntryByteChain.h"
+#include "FLowEntryByteSink.h"
+#include "FLowEntryVarint.h"
+
+
+/**
+* Writes Byte Data, without creating any UObjects.
+*
+* This is what ULowEntryByteDataWriter uses internally, it can be used directly from C++ (on the stack, as a member, etc) to serialize data without any garbage collection overhead.
+*
+* Calling Reset() keeps the allocated memory, so a single writer can be reused for many messages without reallocating.
+*
+* When a sink is set, the writer streams: whenever the buffer holds ChunkSize bytes or more, it hands the buffer to the sink and continues with an empty one, so the memory use stays bounded no matter how much is written. Call Flush() once done, to hand the last bytes to the sink and wait until the sink has written everything.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryByteWriter
+{
+public:
+	static constexpr int32 DefaultChunkSize = 64 * 1024;
+
+	FLowEntryByteWriter() = default;
+	explicit FLowEntryByteWriter(const int32 InitialCapacity);
+	explicit FLowEntryByteWriter(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink, const int32 ChunkSize = DefaultChunkSize);
+
+
+public:
+	TArray<uint8> Bytes;
+
+
+protected:
+	TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe> Sink;
+	int32 FlushThreshold = MAX_int32;
+	int64 FlushedCount = 0;
+
+
+public:
+	/**
+	* Returns the bytes that haven't been handed to the sink yet, which are all bytes when there is no sink.
+	*/
+	const TArray<uint8>& GetBytes() const;
+
+	/**
+	* Moves the bytes out of this writer instead of copying them, afterwards this writer is empty.
+	*/
+	TArray<uint8> TakeBytes();
+
+	/**
+	* Returns the total amount of bytes written, including the bytes that have already been handed to the sink.
+	*/
+	int64 Num() const;
+
+	void Reset();
+
+
+	/**
+	* Makes this writer stream to the given sink, or stops streaming when the sink is null.
+	*/
+	void SetSink(const TSharedPtr<FLowEntryByteSink, ESPMode::ThreadSafe>& Sink_, const int32 ChunkSize = DefaultChunkSize);
+	bool HasSink() const;
+
+	/**
+	* Hands the remaining bytes to the sink and waits until the sink has written everything. Returns false if the sink failed, returns true if there is no sink.
+	*/
+	bool Flush();
+
+	/**
+	* Hands the remaining bytes to the sink and flushes it on the thread pool without waiting for that, and stops streaming. The sink is released once it has written everything.
+	*
+	* Meant for when the writer is being destroyed (during garbage collection for example), where waiting for the sink would block. Since the sink is used from the thread pool, it shouldn't be used by anything else anymore.
+	*/
+	void ReleaseSink();
+
+	void Reserve(const int32 ByteCount);
+
+
+	void AddRawByte(const uint8 Value);
+	void AddRawBytes(const TArrayView<const uint8>& Value);
+	void AddRawBytes(const FLowEntryByteChain& Value);
+
+	void AddUinteger(const int32 Value);
+
+
+	void AddByte(const uint8 Value);
+	void AddInteger(const int32 Value);
+	void AddPositiveInteger1(const int32 Value);
+	void AddPositiveInteger2(const int32 Value);
+	void AddPositiveInteger3(const int32 Value);
+	void AddLong(const int64 Value);
+	void AddFloat(const float Value);
+	void AddDouble(const double Value);
+	void AddBoolean(const bool Value);
+	void AddStringUtf8(const FString& Value);
+	void AddVarInteger(const int32 Value);
+	void AddVarLong(const int64 Value);
+	void AddZigZagInteger(const int32 Value);
+	void AddZigZagLong(const int64 Value);
+
+	void AddByteArray(const TArrayView<const uint8>& Value);
+	void AddByteArray(const FLowEntryByteChain& Value);
+	void AddIntegerArray(const TArrayView<const int32>& Value);
+	void AddPositiveInteger1Array(const TArrayView<const int32>& Value);
+	void AddPositiveInteger2Array(const TArrayView<const int32>& Value);
+	void AddPositiveInteger3Array(const TArrayView<const int32>& Value);
+	void AddLongArray(const TArrayView<const int64>& Value);
+	void AddFloatArray(const TArrayView<const float>& Value);
+	void AddDoubleArray(const TArrayView<const double>& Value);
+	void AddBooleanArray(const TArrayView<const bool>& Value);
+	void AddStringUtf8Array(const TArrayView<const FString>& Value);
+	void AddIntegerArrayDelta(const TArrayView<const int32>& Value);
+	void AddLongArrayDelta(const TArrayView<const int64>& Value);
+
+
+protected:
+	FORCEINLINE void FlushIfFull()
+	{
+		if (Bytes.Num() >= FlushThreshold)
+		{
+			WriteChunk();
+		}
+	}
+
+	void WriteChunk();
+
+	/**
+	* Returns true if a length header followed by Count bytes still fits in a single buffer, arrays that are written in one go have to be checked with this before their length header is written.
+	*/
+	FORCEINLINE bool HasRoomFor(const int64 Count) const
+	{
+		return ((Bytes.Num() + 4 + Count) <= 0x7fffffff);
+	}
+
+	uint8* AddUninitializedRawBytes(const int32 Count);
+	void TrimRawBytes(const int32 Num);
+	void AddVarint(const uint64 Value, const int32 MaxSize);
+
+	FORCEINLINE static int32 WriteUinteger(uint8* Dest, const int32 Value);
+	FORCEINLINE static int32 WritePositiveInteger2(uint8* Dest, const int32 Value);
+	FORCEINLINE static int32 WritePositiveInteger3(uint8* Dest, const int32 Value);
+	FORCEINLINE static void WriteInteger(uint8* Dest, const int32 Value);
+	FORCEINLINE static void WriteLong(uint8* Dest, const int64 Value);
+	FORCEINLINE static void WriteIntegers(uint8* Dest, const int32* Values, const int32 Num);
+	FORCEINLINE static void WriteLongs(uint8* Dest, const int64* Values, const int32 Num);
+};
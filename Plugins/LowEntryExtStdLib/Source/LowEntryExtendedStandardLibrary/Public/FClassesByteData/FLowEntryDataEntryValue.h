@@ -0,0 +1,167 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Misc/TVariant.h"
+#include "Templates/UniquePtr.h"
+
+
+/**
+* The value of a byte data or bit data entry, stored as a tagged variant.
+*
+* Scalars share 8 bytes of inline storage. Strings and arrays are stored behind a single heap pointer, which is only allocated once the entry holds a string or an array, and which is reused (including the capacity of the array) when the entry is set to a value of the same kind again.
+*
+* The type tag itself is kept by the entry, this class only holds the storage. Object references (Long Bytes and Double Bytes) are not stored here, since those have to be visible to the garbage collector.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryDataEntryValue
+{
+public:
+	typedef TVariant<FString, TArray<uint8>, TArray<int32>, TArray<int64>, TArray<float>, TArray<double>, TArray<bool>, TArray<FString>> FPayload;
+
+
+public:
+	FLowEntryDataEntryValue() = default;
+
+	FLowEntryDataEntryValue(const FLowEntryDataEntryValue& Other)
+		: Long(Other.Long)
+		, Payload(Other.Payload.IsValid() ? MakeUnique<FPayload>(*Other.Payload) : nullptr) {}
+
+	FLowEntryDataEntryValue& operator=(const FLowEntryDataEntryValue& Other)
+	{
+		if (this != &Other)
+		{
+			Long = Other.Long;
+			Payload = (Other.Payload.IsValid() ? MakeUnique<FPayload>(*Other.Payload) : nullptr);
+		}
+		return *this;
+	}
+
+	FLowEntryDataEntryValue(FLowEntryDataEntryValue&&) = default;
+	FLowEntryDataEntryValue& operator=(FLowEntryDataEntryValue&&) = default;
+
+
+protected:
+	union
+	{
+		uint8 Byte;
+		int32 Integer;
+		int64 Long = 0;
+		float Float;
+		double Double;
+		bool Boolean;
+	};
+
+	TUniquePtr<FPayload> Payload;
+
+
+public:
+	/**
+	* Stores a scalar, releasing the string or array payload if there is one.
+	*/
+	FORCEINLINE void SetByte(const uint8 Value)
+	{
+		Reset();
+		Byte = Value;
+	}
+	FORCEINLINE void SetInteger(const int32 Value)
+	{
+		Reset();
+		Integer = Value;
+	}
+	FORCEINLINE void SetLong(const int64 Value)
+	{
+		Reset();
+		Long = Value;
+	}
+	FORCEINLINE void SetFloat(const float Value)
+	{
+		Reset();
+		Float = Value;
+	}
+	FORCEINLINE void SetDouble(const double Value)
+	{
+		Reset();
+		Double = Value;
+	}
+	FORCEINLINE void SetBoolean(const bool Value)
+	{
+		Reset();
+		Boolean = Value;
+	}
+
+	FORCEINLINE uint8 GetByte() const
+	{
+		return Byte;
+	}
+	FORCEINLINE int32 GetInteger() const
+	{
+		return Integer;
+	}
+	FORCEINLINE int64 GetLong() const
+	{
+		return Long;
+	}
+	FORCEINLINE float GetFloat() const
+	{
+		return Float;
+	}
+	FORCEINLINE double GetDouble() const
+	{
+		return Double;
+	}
+	FORCEINLINE bool GetBoolean() const
+	{
+		return Boolean;
+	}
+
+
+	/**
+	* Stores a string or an array. Reuses the existing payload if it already holds the same kind of value.
+	*/
+	template<typename T>
+	void SetPayload(T&& Value)
+	{
+		typedef typename TDecay<T>::Type FValueType;
+		Long = 0;
+		if (!Payload.IsValid())
+		{
+			Payload = MakeUnique<FPayload>(TInPlaceType<FValueType>(), Forward<T>(Value));
+			return;
+		}
+		if (FValueType* Existing = Payload->template TryGet<FValueType>())
+		{
+			*Existing = Forward<T>(Value);
+			return;
+		}
+		Payload->template Emplace<FValueType>(Forward<T>(Value));
+	}
+
+	/**
+	* Returns the stored string or array, or an empty one if the entry doesn't hold a value of that kind.
+	*/
+	template<typename T>
+	const T& GetPayload() const
+	{
+		if (Payload.IsValid())
+		{
+			if (const T* Existing = Payload->template TryGet<T>())
+			{
+				return *Existing;
+			}
+		}
+		static const T Empty;
+		return Empty;
+	}
+
+
+	/**
+	* Clears the value, releasing the string or array payload if there is one.
+	*/
+	FORCEINLINE void Reset()
+	{
+		Long = 0;
+		Payload.Reset();
+	}
+};
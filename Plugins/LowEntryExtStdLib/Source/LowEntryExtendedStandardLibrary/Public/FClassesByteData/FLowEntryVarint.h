@@ -0,0 +1,106 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+#include "Misc/ByteSwap.h"
+
+
+/**
+* The variable length integer encodings used by Byte Data and Bit Data.
+*
+* Var integers and var longs are LEB128: 7 bits per byte, least significant group first, the highest bit of every byte except the last one is set. Values under 128 take 1 byte, an integer takes at most 5 bytes and a long at most 10 bytes. Negative values are treated as unsigned, so they always take the maximum amount of bytes, ZigZag encoding fixes that by mapping 0, -1, 1, -2, 2, ... to 0, 1, 2, 3, 4, ...
+*
+* Delta arrays store the ZigZag var integer of the difference with the previous value (the first value is stored as is), which keeps sorted or slowly changing sequences (timestamps, ids, etc) down to about 1 byte per value.
+*/
+struct LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryVarint
+{
+	static constexpr int32 MaxIntegerSize = 5;
+	static constexpr int32 MaxLongSize = 10;
+
+
+	FORCEINLINE static uint32 ZigZagEncode(const int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	FORCEINLINE static uint64 ZigZagEncode(const int64 Value)
+	{
+		return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	}
+
+	FORCEINLINE static int32 ZigZagDecode(const uint32 Value)
+	{
+		return static_cast<int32>((Value >> 1) ^ (~(Value & 1) + 1));
+	}
+
+	FORCEINLINE static int64 ZigZagDecode(const uint64 Value)
+	{
+		return static_cast<int64>((Value >> 1) ^ (~(Value & 1) + 1));
+	}
+
+
+	/**
+	* Writes the given value to Dest, returns the amount of bytes written. Dest needs room for MaxLongSize bytes (or MaxIntegerSize bytes when the value fits in 32 bits).
+	*/
+	FORCEINLINE static int32 Write(uint8* Dest, uint64 Value)
+	{
+		int32 Count = 0;
+		while (Value >= 0x80)
+		{
+			Dest[Count++] = static_cast<uint8>(Value | 0x80);
+			Value >>= 7;
+		}
+		Dest[Count++] = static_cast<uint8>(Value);
+		return Count;
+	}
+
+	/**
+	* Reads a value from Src, which has Available bytes, a value can be at most MaxSize bytes long.
+	*
+	* Returns the amount of bytes read, or 0 if the data ends before the value does or if the value is longer than MaxSize (Value is 0 then).
+	*
+	* When at least 8 bytes are available, values of up to 8 bytes are decoded without looping over the bytes: the end of the value is found with a single bit scan over all 8 bytes at once, and the 7 bit groups are then packed together with 3 shifts.
+	*/
+	FORCEINLINE static int32 Read(const uint8* Src, const int32 Available, const int32 MaxSize, uint64& Value)
+	{
+		if (Available >= 8)
+		{
+			uint64 Word;
+			FMemory::Memcpy(&Word, Src, 8);
+#if !PLATFORM_LITTLE_ENDIAN
+			Word = BYTESWAP_ORDER64(Word);
+#endif
+			const uint64 Ends = (~Word & 0x8080808080808080ull);
+			if (Ends != 0)
+			{
+				const int32 Count = (FMath::CountTrailingZeros64(Ends) >> 3) + 1;
+				if (Count <= MaxSize)
+				{
+					Word &= (Ends ^ (Ends - 1)) & 0x7f7f7f7f7f7f7f7full;
+					Word = ((Word & 0x7f007f007f007f00ull) >> 1) | (Word & 0x007f007f007f007full);
+					Word = ((Word & 0x3fff00003fff0000ull) >> 2) | (Word & 0x00003fff00003fffull);
+					Word = ((Word & 0x0fffffff00000000ull) >> 4) | (Word & 0x000000000fffffffull);
+					Value = Word;
+					return Count;
+				}
+			}
+		}
+
+		const int32 Count = FMath::Min(Available, MaxSize);
+		uint64 Result = 0;
+		for (int32 i = 0; i < Count; i++)
+		{
+			const uint8 B = Src[i];
+			Result |= static_cast<uint64>(B & 0x7f) << (7 * i);
+			if ((B & 0x80) == 0)
+			{
+				Value = Result;
+				return i + 1;
+			}
+		}
+		Value = 0;
+		return 0;
+	}
+};
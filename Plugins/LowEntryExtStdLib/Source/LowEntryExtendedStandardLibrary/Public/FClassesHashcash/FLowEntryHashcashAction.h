@@ -0,0 +1,96 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+
+#include "LowEntryHashingHashcashLibrary.h"
+
+
+/**
+* Creates Hashcash hashes on the thread pool, and triggers the latent node once they are all done.
+*
+* The work is cancelled as soon as possible when the latent action is aborted or its owner is destroyed, so no threads will keep on minting hashes nobody is waiting for anymore.
+*/
+class FLowEntryHashcashAction : public FPendingLatentAction
+{
+public:
+	struct FState
+	{
+		FThreadSafeBool Cancelled = false;
+		FThreadSafeBool Finished = false;
+		TArray<FString> Hashes;
+	};
+
+
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	TArray<FString>* ResultArray;
+	FString* ResultString;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+
+	FLowEntryHashcashAction(const TArray<FString>& Resources, const FDateTime& UtcDate, const int32 Bits, TArray<FString>* ResultArray0, FString* ResultString0, const FLatentActionInfo& LatentInfo)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, ResultArray(ResultArray0)
+		, ResultString(ResultString0)
+		, State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{
+		TSharedRef<FState, ESPMode::ThreadSafe> TaskState = State;
+		Async(EAsyncExecution::ThreadPool, [TaskState, Resources, UtcDate, Bits]()
+		{
+			TaskState->Hashes = ULowEntryHashingHashcashLibrary::hashArrayParallel(Resources, UtcDate, Bits, &TaskState->Cancelled);
+			TaskState->Finished = true;
+		});
+	}
+
+	virtual ~FLowEntryHashcashAction()
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!State->Finished)
+		{
+			return;
+		}
+		if (ResultArray != nullptr)
+		{
+			*ResultArray = MoveTemp(State->Hashes);
+		}
+		if (ResultString != nullptr)
+		{
+			*ResultString = (State->Hashes.Num() > 0) ? MoveTemp(State->Hashes[0]) : TEXT("");
+		}
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	virtual void NotifyObjectDestroyed() override
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void NotifyActionAborted() override
+	{
+		State->Cancelled = true;
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return State->Finished ? TEXT("Hashcash (done)") : TEXT("Hashcash (creating)");
+	}
+#endif
+};
@@ -0,0 +1,89 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+
+
+/**
+* Runs the given work on the thread pool, then runs the given completion on the game thread and triggers the latent node.
+*
+* The work is used for encoding and decoding images, it shouldn't touch any UObjects. The completion is where the results are turned into textures and written to the outputs of the node, it isn't called if the latent action was aborted or its owner was destroyed.
+*/
+class FLowEntryImageAction : public FPendingLatentAction
+{
+public:
+	struct FState
+	{
+		FThreadSafeBool Cancelled = false;
+		FThreadSafeBool Finished = false;
+	};
+
+
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+	TFunction<void()> Complete;
+
+	FLowEntryImageAction(TFunction<void()>&& Work, TFunction<void()>&& Complete0, const FLatentActionInfo& LatentInfo)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, State(MakeShared<FState, ESPMode::ThreadSafe>())
+		, Complete(MoveTemp(Complete0))
+	{
+		TSharedRef<FState, ESPMode::ThreadSafe> TaskState = State;
+		Async(EAsyncExecution::ThreadPool, [TaskState, Work = MoveTemp(Work)]()
+		{
+			if (!TaskState->Cancelled)
+			{
+				Work();
+			}
+			TaskState->Finished = true;
+		});
+	}
+
+	virtual ~FLowEntryImageAction()
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!State->Finished)
+		{
+			return;
+		}
+		if (!State->Cancelled && Complete)
+		{
+			Complete();
+		}
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+	virtual void NotifyObjectDestroyed() override
+	{
+		State->Cancelled = true;
+	}
+
+	virtual void NotifyActionAborted() override
+	{
+		State->Cancelled = true;
+	}
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override
+	{
+		return State->Finished ? TEXT("Image (done)") : TEXT("Image (processing)");
+	}
+#endif
+};
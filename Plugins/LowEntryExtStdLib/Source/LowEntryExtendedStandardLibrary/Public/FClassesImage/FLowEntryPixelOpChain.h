@@ -0,0 +1,78 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "ELowEntryPixelOp.h"
+
+
+/**
+* Applies a list of pixel operations (grayscale, channel flips, channel inverts) to pixels in a single pass over the memory.
+*
+* Flips and inverts that follow each other are combined into one byte shuffle, which is done 4 pixels at a time with SSE or NEON where available. The pixels are processed in small chunks that are spread over all cores for large images, every operation is applied to a chunk while it's still in the cache.
+*
+* The results are exactly the same as those of the separate Grayscale Pixels, Flip Pixel Channels and Invert Pixel Channel functions.
+*/
+class LOWENTRYEXTENDEDSTANDARDLIBRARY_API FLowEntryPixelOpChain
+{
+public:
+	/** The amount of pixels that are processed at a time, small enough to stay in the cache between operations. */
+	constexpr static int32 CHUNK_SIZE = 4096;
+
+	/** Below this amount of pixels everything is done on the calling thread. */
+	constexpr static int32 PARALLEL_MIN_COUNT = 256 * 256;
+
+
+protected:
+	struct FStage
+	{
+		bool Grayscale = false;
+
+		/** Byte I of every output pixel is byte Shuffle[I] of the input pixel, xor'ed with Xor[I]. */
+		uint8 Shuffle[4] = {0, 1, 2, 3};
+		uint8 Xor[4] = {0, 0, 0, 0};
+	};
+
+
+public:
+	FLowEntryPixelOpChain() = default;
+	explicit FLowEntryPixelOpChain(const ELowEntryPixelOp Op);
+	explicit FLowEntryPixelOpChain(const TArray<ELowEntryPixelOp>& Ops);
+
+
+protected:
+	TArray<FStage, TInlineAllocator<4>> Stages;
+
+
+public:
+	void Add(const ELowEntryPixelOp Op);
+
+	/**
+	* Returns true if applying this chain wouldn't change any pixels.
+	*/
+	bool IsEmpty() const;
+
+	/**
+	* Applies the operations to Src and writes the results to Dest. Dest can be the same as Src, to change the pixels in place.
+	*/
+	void Apply(const FColor* Src, FColor* Dest, const int32 Count) const;
+
+	/**
+	* Returns a copy of the given pixels with the operations applied to them.
+	*/
+	TArray<FColor> Apply(const TArray<FColor>& Pixels) const;
+
+	/**
+	* Applies the operations to the given pixels, in place.
+	*/
+	void ApplyInPlace(TArray<FColor>& Pixels) const;
+
+
+protected:
+	void ApplyChunk(const FColor* Src, FColor* Dest, const int32 Count) const;
+
+	static void ApplyShuffle(const FStage& Stage, const FColor* Src, FColor* Dest, const int32 Count);
+	static void ApplyGrayscale(const FColor* Src, FColor* Dest, const int32 Count);
+};
@@ -0,0 +1,74 @@
+// Copyright Low Entry. Apache License, Version 2.0.
+
+#pragma once
+
+
+#include "CoreMinimal.h"
+
+#include "LatentActions.h"
+#include "HAL/ThreadSafeBool.h"
+
+
+class UTextureRenderTarget2D;
+class FRHIGPUTextureReadback;
+
+
+/**
+* Reads the pixels of a TextureRenderTarget2D back from the GPU without stalling the game thread.
+*
+* The copy to a staging buffer is requested right away, the action then checks once per frame (on the render thread) if the GPU is done with it, which usually takes a few frames. Once it is, the pixels are copied out of the staging buffer and the given work is run on the thread pool, after which the given completion is run on the game thread and the latent node is triggered.
+*
+* The staging buffers are reused between readbacks of render targets of the same size, so taking a screenshot every few frames doesn't create new GPU resources every time.
+*
+* If the readback can't be done (no render target, no RHI texture, or the GPU doesn't respond in time), the work is not run and the completion is run with the outputs left empty.
+*/
+class FLowEntryRenderTargetReadbackAction : public FPendingLatentAction
+{
+public:
+	typedef TFunction<void(const int32 Width, const int32 Height, TArray<FColor>&& Pixels)> FWork;
+
+	struct FState
+	{
+		FThreadSafeBool Cancelled = false;
+		FThreadSafeBool Polling = false;
+		FThreadSafeBool Finished = false;
+
+		int32 Width = 0;
+		int32 Height = 0;
+
+		/** Only used on the render thread once the copy has been requested. */
+		TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> Readback;
+
+		/** Only used on the thread pool. */
+		FWork Work;
+	};
+
+
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+	TFunction<void()> Complete;
+	double StartTime = 0;
+
+	FLowEntryRenderTargetReadbackAction(UTextureRenderTarget2D* TextureRenderTarget2D, FWork&& Work, TFunction<void()>&& Complete0, const FLatentActionInfo& LatentInfo);
+	virtual ~FLowEntryRenderTargetReadbackAction();
+
+	virtual void UpdateOperation(FLatentResponse& Response) override;
+	virtual void NotifyObjectDestroyed() override;
+	virtual void NotifyActionAborted() override;
+
+#if WITH_EDITOR
+	// Returns a human readable description of the latent operation's current state
+	virtual FString GetDescription() const override;
+#endif
+
+
+protected:
+	static void Poll(const TSharedRef<FState, ESPMode::ThreadSafe>& State);
+
+	static TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe> TakeReadback(const FIntPoint& Size);
+	static void GiveBackReadback(TSharedPtr<FRHIGPUTextureReadback, ESPMode::ThreadSafe>&& Readback, const FIntPoint& Size);
+};